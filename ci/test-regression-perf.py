@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+
+# =============================================================================
+# ==================================================================== PACKAGES
+
+import os
+import signal
+import sys
+import time
+import json
+import shlex
+import argparse
+import subprocess
+
+# ==================================================================== PACKAGES
+# =============================================================================
+
+# =============================================================================
+# ================================================================== PARAMETERS
+
+parser = argparse.ArgumentParser(prog='aff3ct-test-regression-perf', formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+parser.add_argument('--refs-path',        action='store', dest='refsPath',        type=str,   default="ci/test-regression-perf.json",       help='Path to the curated command lines to replay (JSON).')
+parser.add_argument('--baselines-path',   action='store', dest='baselinesPath',   type=str,   default="test-regression-perf-baselines.json", help='Path to the throughput baselines (JSON), created if it does not exist.')
+parser.add_argument('--report-path',      action='store', dest='reportPath',      type=str,   default="test-regression-perf-report.json",    help='Path to the machine-readable report (JSON).')
+parser.add_argument('--build-path',       action='store', dest='buildPath',       type=str,   default="build",                               help='Path to the AFF3CT build.')
+parser.add_argument('--binary-path',      action='store', dest='binaryPath',      type=str,   default="bin/aff3ct",                          help='Path to the AFF3CT binary.')
+parser.add_argument('--tolerance',        action='store', dest='tolerance',       type=float, default=0.10,                                  help='Tolerated relative throughput loss of a task vs its baseline.')                          # choices=xrange(0.0, 1.0 )
+parser.add_argument('--min-time',         action='store', dest='minTime',         type=float, default=0.05,                                  help='Minimum time spent in a task (in seconds) to compare its throughput (too noisy below).') # choices=xrange(0.0, +inf)
+parser.add_argument('--n-runs',           action='store', dest='nRuns',           type=int,   default=3,                                     help='Number of runs per command line, the best throughput of each task is kept.')              # choices=xrange(1,   +inf)
+parser.add_argument('--n-threads',        action='store', dest='nThreads',        type=int,   default=1,                                     help='Number of threads to use in the simulation (0 = all available).')                        # choices=xrange(0,   +inf)
+parser.add_argument('--update-baselines', action='store', dest='updateBaselines', type=bool,  default=False,                                 help='Replace the baselines by the measured throughputs.')
+parser.add_argument('--verbose',          action='store', dest='verbose',         type=bool,  default=False,                                 help='Enable the verbose mode.')
+
+# ================================================================== PARAMETERS
+# =============================================================================
+
+# =============================================================================
+# =================================================================== FUNCTIONS
+
+def parseStatistics(stdOutput):
+	# parse the tables displayed by the '--sim-stats' parameter (one table per noise point), the throughput of a task
+	# over all the noise points is weighted by the time spent in the task at each noise point
+	stats = {}
+	for line in stdOutput:
+		if not line.startswith("#"):
+			continue
+
+		groups = line[1:].split("||")
+		if len(groups) != 4:
+			continue
+
+		ids = [s.strip() for s in groups[0].split("|")]
+		bas = [s.strip() for s in groups[1].split("|")]
+		thr = [s.strip() for s in groups[2].split("|")]
+		if len(ids) != 3 or len(bas) != 3 or len(thr) != 3:
+			continue
+
+		module, task, timer = ids
+		if timer != "*" or module == "-" or module == "MODULE" or module == "":
+			continue
+
+		try:
+			nCalls  = float(bas[0])
+			totTime = float(bas[1])
+			avgThr  = float(thr[0])
+		except ValueError:
+			continue
+
+		name = module + "::" + task
+		if name not in stats:
+			stats[name] = {"n_calls": 0, "time": 0.0, "elmts": 0.0, "thr_sum": 0.0, "n_tables": 0}
+
+		stats[name]["n_calls" ] += nCalls
+		stats[name]["time"    ] += totTime
+		stats[name]["elmts"   ] += avgThr * totTime
+		stats[name]["thr_sum" ] += avgThr
+		stats[name]["n_tables"] += 1
+
+	for name in stats:
+		s = stats[name]
+		# the displayed time is rounded to 10 ms, fall back to the plain average for the very fast tasks
+		if s["time"] > 0:
+			s["throughput"] = s["elmts"] / s["time"]
+		else:
+			s["throughput"] = s["thr_sum"] / s["n_tables"]
+		del s["elmts"], s["thr_sum"], s["n_tables"]
+
+	return stats
+
+
+def runCommand(test):
+	argsAFFECT  = [args.binaryPath]
+	argsAFFECT += shlex.split(test["command"])
+	argsAFFECT += ["--sim-stats", "--sim-no-colors", "--ter-freq", "0", "-t", str(args.nThreads), "--sim-meta", test["id"]]
+
+	os.chdir(args.buildPath)
+	startTime = time.time()
+	try:
+		processAFFECT = subprocess.Popen(argsAFFECT, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+		(stdoutAFFECT, stderrAFFECT) = processAFFECT.communicate()
+	except KeyboardInterrupt:
+		os.kill(processAFFECT.pid, signal.SIGINT)
+		(stdoutAFFECT, stderrAFFECT) = processAFFECT.communicate()
+	elapsedTime = time.time() - startTime
+	os.chdir(PathOrigin)
+
+	stdOutput = stdoutAFFECT.decode(encoding='UTF-8').split("\n")
+	errOutput = stderrAFFECT.decode(encoding='UTF-8')
+
+	return processAFFECT.returncode, stdOutput, errOutput, elapsedTime
+
+
+def compareTasks(stats, baseline):
+	tasks = []
+	for name in sorted(stats):
+		s = stats[name]
+		t = {"task":       name,
+		     "n_calls":    int(s["n_calls"]),
+		     "time":       s["time"],
+		     "throughput": s["throughput"],
+		     "baseline":   None,
+		     "ratio":      None}
+
+		if name in baseline and baseline[name] > 0:
+			t["baseline"] = baseline[name]
+			t["ratio"   ] = s["throughput"] / baseline[name]
+
+		if t["baseline"] is None:
+			t["status"] = "NEW"
+		elif s["time"] < args.minTime:
+			t["status"] = "IGNORED"
+		elif t["ratio"] < 1.0 - args.tolerance:
+			t["status"] = "REGRESSION"
+		elif t["ratio"] > 1.0 + args.tolerance:
+			t["status"] = "IMPROVEMENT"
+		else:
+			t["status"] = "PASSED"
+
+		tasks.append(t)
+
+	for name in sorted(baseline):
+		if name not in stats:
+			tasks.append({"task": name, "n_calls": 0, "time": 0.0, "throughput": 0.0, "baseline": baseline[name],
+			              "ratio": 0.0, "status": "MISSING"})
+
+	return tasks
+
+
+def getResumeTable(tasks):
+	message  = "---- -----------------------------------|----------|------------|------------|---------|------------ \n"
+	message += "----                               task | time (s) | thr (Mb/s) | ref (Mb/s) |   ratio | status      \n"
+	message += "---- -----------------------------------|----------|------------|------------|---------|------------ \n"
+	for t in tasks:
+		message += "---- " + t["task"].rjust(34) + " "
+		message += "| " + ("%.2f" % t["time"]).rjust(8) + " "
+		message += "| " + ("%.2f" % t["throughput"]).rjust(10) + " "
+		message += "| " + (("%.2f" % t["baseline"]) if t["baseline"] is not None else "-").rjust(10) + " "
+		message += "| " + (("%.3f" % t["ratio"]) if t["ratio"] is not None else "-").rjust(7) + " "
+		message += "| " + t["status"] + "\n"
+	return message
+
+# =================================================================== FUNCTIONS
+# =============================================================================
+
+# =============================================================================
+# ======================================================================== MAIN
+
+args = parser.parse_args()
+
+if args.nRuns <= 0:
+	args.nRuns = 1
+
+print('# AFF3CT performance tests')
+print('# ------------------------')
+print('#')
+print('# Parameters:')
+print('# refs path        =', args.refsPath       )
+print('# baselines path   =', args.baselinesPath  )
+print('# report path      =', args.reportPath     )
+print('# build path       =', args.buildPath      )
+print('# binary path      =', args.binaryPath     )
+print('# tolerance        =', args.tolerance      )
+print('# min time         =', args.minTime        )
+print('# n runs           =', args.nRuns          )
+print('# n threads        =', args.nThreads       )
+print('# update baselines =', args.updateBaselines)
+print('# verbose          =', args.verbose        )
+print('#')
+
+PathOrigin = os.getcwd()
+
+with open(args.refsPath, 'r') as f:
+	tests = json.load(f)["tests"]
+
+baselines = {}
+if os.path.isfile(args.baselinesPath):
+	with open(args.baselinesPath, 'r') as f:
+		baselines = json.load(f)
+else:
+	print("# (WW) The baselines file does not exist, the measured throughputs will be recorded as the new baselines.")
+
+if len(tests):
+	print("# (II) Starting the performance test script...")
+else:
+	print("# (WW) There is no command line to replay.")
+
+report = {"binary":    args.binaryPath,
+          "tolerance": args.tolerance,
+          "min_time":  args.minTime,
+          "n_runs":    args.nRuns,
+          "n_threads": args.nThreads,
+          "tests":     []}
+
+failIds          = []
+nErrors          = 0
+nNew             = 0
+testId           = 0
+baselinesChanged = False
+
+for test in tests:
+	print("Test n°" + str(testId+1) + " / " + str(len(tests)) + " - " + test["id"], end="", flush=True);
+
+	# keep the best throughput of each task over the runs (the less disturbed by the system)
+	stats       = {}
+	returnCode  = 0
+	errMessages = ""
+	elapsedTime = 0.0
+	for r in range(args.nRuns):
+		returnCode, stdOutput, errMessages, runTime = runCommand(test)
+		elapsedTime += runTime
+		if returnCode:
+			break
+
+		for name, s in parseStatistics(stdOutput).items():
+			if name not in stats or s["throughput"] > stats[name]["throughput"]:
+				stats[name] = s
+
+	baseline = baselines[test["id"]] if test["id"] in baselines else {}
+	result = {"id":           test["id"],
+	          "command":      test["command"],
+	          "elapsed_time": elapsedTime,
+	          "tasks":        []}
+
+	if returnCode:
+		print(" - ABORTED.", end="\n");
+		if errMessages:
+			print("---- Error message(s):", end="\n");
+			print(errMessages)
+		result["status"] = "ABORTED"
+		nErrors += 1
+		failIds.append(testId +1)
+
+	elif not len(stats):
+		print(" - NO STATISTICS.", end="\n");
+		result["status"] = "ABORTED"
+		nErrors += 1
+		failIds.append(testId +1)
+
+	else:
+		result["tasks"] = compareTasks(stats, baseline)
+		statusList = [t["status"] for t in result["tasks"]]
+
+		print(" - %.2f" %elapsedTime, "sec", end="")
+
+		if "REGRESSION" in statusList or "MISSING" in statusList:
+			nRegressions = statusList.count("REGRESSION") + statusList.count("MISSING")
+			print(" - FAILED (" + str(nRegressions) + " task(s) slower than the baseline).", end="\n");
+			result["status"] = "FAILED"
+			nErrors += 1
+			failIds.append(testId +1)
+
+		elif not len(baseline):
+			print(" - NEW.", end="\n");
+			result["status"] = "NEW"
+			nNew += 1
+
+		else:
+			print(" - PASSED.", end="\n");
+			result["status"] = "PASSED"
+
+		if args.verbose:
+			print(getResumeTable(result["tasks"]))
+
+		if args.updateBaselines or not len(baseline):
+			baselines[test["id"]] = {name: s["throughput"] for name, s in stats.items()}
+			baselinesChanged = True
+
+	report["tests"].append(result)
+	testId += 1
+
+report["summary"] = {"n_tests":  len(tests),
+                     "n_failed": nErrors,
+                     "n_new":    nNew,
+                     "n_passed": len(tests) - nErrors - nNew,
+                     "fail_ids": failIds}
+
+with open(args.reportPath, 'w') as f:
+	json.dump(report, f, indent=4)
+
+if baselinesChanged:
+	with open(args.baselinesPath, 'w') as f:
+		json.dump(baselines, f, indent=4, sort_keys=True)
+	print("\n# (II) The baselines have been written in '" + args.baselinesPath + "'.", end="")
+
+if len(tests):
+	print("\n# " + str(len(tests)) + " tests executed: " + str(len(tests) - nErrors - nNew) + " passed tests, "
+		  + str(nNew) + " new tests, " + str(nErrors) + " failed tests", end="\n")
+	print("# Report written in '" + args.reportPath + "'.", end="\n")
+
+	if nErrors == 0:
+		print("\n# (II) All the tests PASSED !", end="");
+	else:
+		print("\n# (II) FAILED tests: ", end="")
+		f = 0
+		for failId in failIds:
+			print("n°", end="")
+			print(str(failId), end="")
+			if f == len(failIds) -1:
+				print(".", end="")
+			else:
+				print(", ", end="")
+			f = f + 1
+
+	print("\n")
+
+sys.exit(nErrors);
+
+# ======================================================================== MAIN
+# =============================================================================
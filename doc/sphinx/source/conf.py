@@ -322,6 +322,7 @@ rst_epilog = """
 .. |MWBF|      replace:: :abbr:`MWBF     (Modified Weighted Bit Flipping)`
 .. |NEON|      replace:: :abbr:`NEON     (ARM SIMD instructions)`
 .. |NMS|       replace:: :abbr:`NMS      (Normalized Min-Sum)`
+.. |NUMA|      replace:: :abbr:`NUMA     (Non-Uniform Memory Access)`
 .. |OMS|       replace:: :abbr:`OMS      (Offset Min-Sum)`
 .. |ONMS|      replace:: :abbr:`ONMS     (Offset Normalized Min-Sum)`
 .. |OOK|       replace:: :abbr:`OOK      (On-Off Keying)`
@@ -353,6 +354,7 @@ rst_epilog = """
 .. |SF|        replace:: :abbr:`SF       (Scaling Factor)`
 .. |SFs|       replace:: :abbr:`SFs      (Scaling Factors)`
 .. |SIMD|      replace:: :abbr:`SIMD     (Single Instruction Multiple Data)`
+.. |SMT|       replace:: :abbr:`SMT      (Simultaneous Multi-Threading)`
 .. |SNRs|      replace:: :abbr:`SNRs     (Signal Noise Ratios)`
 .. |SNR|       replace:: :abbr:`SNR      (Signal Noise Ratio)`
 .. |SPC|       replace:: :abbr:`SPC      (Single Parity Check)`
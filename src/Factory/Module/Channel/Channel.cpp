@@ -18,6 +18,7 @@
 #include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp"
 #include "Tools/Algo/Draw_generator/Event_generator/Standard/Event_generator_std.hpp"
 #include "Tools/Algo/Draw_generator/Event_generator/Fast/Event_generator_fast.hpp"
+#include "Tools/Algo/Draw_generator/Event_generator/Sparse/Event_generator_sparse.hpp"
 #include "Tools/Algo/Draw_generator/User_pdf_noise_generator/Standard/User_pdf_noise_generator_std.hpp"
 #include "Tools/Algo/Draw_generator/User_pdf_noise_generator/Fast/User_pdf_noise_generator_fast.hpp"
 #ifdef AFF3CT_CHANNEL_MKL
@@ -68,7 +69,7 @@ void Channel::parameters
 		                                 "USER_ADD", "USER_BEC", "USER_BSC")));
 
 	tools::add_arg(args, p, class_name+"p+implem",
-		tools::Text(tools::Including_set("STD", "FAST")));
+		tools::Text(tools::Including_set("STD", "FAST", "SPARSE")));
 
 #ifdef AFF3CT_CHANNEL_GSL
 	tools::add_options(args.at({p+"-implem"}), 0, "GSL");
@@ -86,6 +87,9 @@ void Channel::parameters
 	tools::add_arg(args, p, class_name+"p+noise",
 		tools::Real(tools::Positive(), tools::Non_zero()));
 
+	tools::add_arg(args, p, class_name+"p+sparse-thr",
+		tools::Real(tools::Positive(), tools::Non_zero()));
+
 	tools::add_arg(args, p, class_name+"p+seed,S",
 		tools::Integer(tools::Positive()));
 
@@ -115,6 +119,7 @@ void Channel::parameters
 	if(vals.exist({p+"-add-users"    })) this->add_users    = true;
 	if(vals.exist({p+"-complex"      })) this->complex      = true;
 	if(vals.exist({p+"-noise"        })) this->noise        = vals.to_float({p+"-noise"      });
+	if(vals.exist({p+"-sparse-thr"   })) this->sparse_thr   = vals.to_float({p+"-sparse-thr" });
 }
 
 void Channel::parameters
@@ -125,6 +130,9 @@ void Channel::parameters
 	headers[p].push_back(std::make_pair("Type",           this->type  ));
 	headers[p].push_back(std::make_pair("Implementation", this->implem));
 
+	if (this->implem == "SPARSE" && (this->type == "BEC" || this->type == "BSC"))
+		headers[p].push_back(std::make_pair("Sparse threshold", std::to_string(this->sparse_thr)));
+
 	if (full) headers[p].push_back(std::make_pair("Frame size (N)", std::to_string(this->N)));
 	if (full) headers[p].push_back(std::make_pair("Inter frame level", std::to_string(this->n_frames)));
 
@@ -154,6 +162,7 @@ module::Channel<R>* Channel::parameters
 	std::unique_ptr<tools::Event_generator<R>> n;
 	     if (implem == "STD" ) n.reset(new tools::Event_generator_std <R>(seed));
 	else if (implem == "FAST") n.reset(new tools::Event_generator_fast<R>(seed));
+	else if (implem == "SPARSE") n.reset(new tools::Event_generator_sparse<R>(seed, (R)sparse_thr));
 #ifdef AFF3CT_CHANNEL_MKL
 	else if (implem == "MKL" ) n.reset(new tools::Event_generator_MKL<R>(seed));
 #endif
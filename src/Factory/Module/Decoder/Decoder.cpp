@@ -3,7 +3,9 @@
 #include "Tools/Documentation/documentation.h"
 #include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_std.hpp"
 #include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_naive.hpp"
+#include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_fast.hpp"
 #include "Module/Decoder/Generic/Chase/Decoder_chase_std.hpp"
+#include "Module/Decoder/Generic/Chase/Decoder_chase_fast.hpp"
 #include "Factory/Module/Decoder/Decoder.hpp"
 
 using namespace aff3ct;
@@ -45,7 +47,7 @@ void Decoder::parameters
 		tools::Text(tools::Including_set("ML", "CHASE")));
 
 	tools::add_arg(args, p, class_name+"p+implem",
-		tools::Text(tools::Including_set("STD", "NAIVE")));
+		tools::Text(tools::Including_set("STD", "NAIVE", "FAST")));
 
 	tools::add_arg(args, p, class_name+"p+hamming",
 		tools::None());
@@ -53,6 +55,9 @@ void Decoder::parameters
 	tools::add_arg(args, p, class_name+"p+flips",
 		tools::Integer(tools::Positive()));
 
+	tools::add_arg(args, p, class_name+"p+ml-threads",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+
 	tools::add_arg(args, p, class_name+"p+seed",
 		tools::Integer(tools::Positive()));
 }
@@ -66,6 +71,7 @@ void Decoder::parameters
 	if(vals.exist({p+"-cw-size",   "N"})) this->N_cw       = vals.to_int({p+"-cw-size",   "N"});
 	if(vals.exist({p+"-fra",       "F"})) this->n_frames   = vals.to_int({p+"-fra",       "F"});
 	if(vals.exist({p+"-flips"         })) this->flips      = vals.to_int({p+"-flips"         });
+	if(vals.exist({p+"-ml-threads"    })) this->ml_threads = vals.to_int({p+"-ml-threads"    });
 	if(vals.exist({p+"-seed"          })) this->seed       = vals.to_int({p+"-seed"          });
 	if(vals.exist({p+"-type",      "D"})) this->type       = vals.at    ({p+"-type",      "D"});
 	if(vals.exist({p+"-implem"        })) this->implem     = vals.at    ({p+"-implem"        });
@@ -91,6 +97,8 @@ void Decoder::parameters
 		headers[p].push_back(std::make_pair("Distance", this->hamming ? "Hamming" : "Euclidean"));
 	if(this->type == "CHASE")
 		headers[p].push_back(std::make_pair("Max flips", std::to_string(this->flips)));
+	if(this->type == "ML" && this->implem == "FAST")
+		headers[p].push_back(std::make_pair("Threads", std::to_string(this->ml_threads)));
 
 	if (full) headers[p].push_back(std::make_pair("Seed", std::to_string(this->seed)));
 }
@@ -105,10 +113,12 @@ module::Decoder_SIHO<B,Q>* Decoder::parameters
 		{
 			if (this->implem == "STD"  ) return new module::Decoder_ML_std  <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
 			if (this->implem == "NAIVE") return new module::Decoder_ML_naive<B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
+			if (this->implem == "FAST" ) return new module::Decoder_ML_fast <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->ml_threads, this->n_frames);
 		}
 		else if (this->type == "CHASE")
 		{
-			if (this->implem == "STD") return new module::Decoder_chase_std<B,Q>(this->K, this->N_cw, *encoder, this->flips, this->hamming, this->n_frames);
+			if (this->implem == "STD" ) return new module::Decoder_chase_std <B,Q>(this->K, this->N_cw, *encoder, this->flips, this->hamming, this->n_frames);
+			if (this->implem == "FAST") return new module::Decoder_chase_fast<B,Q>(this->K, this->N_cw, *encoder, this->flips, this->hamming, this->n_frames);
 		}
 	}
 
@@ -125,6 +135,7 @@ module::Decoder_SIHO_HIHO<B,Q>* Decoder::parameters
 		{
 			if (this->implem == "STD"  ) return new module::Decoder_ML_std  <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
 			if (this->implem == "NAIVE") return new module::Decoder_ML_naive<B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
+			if (this->implem == "FAST" ) return new module::Decoder_ML_fast <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->ml_threads, this->n_frames);
 		}
 	}
 
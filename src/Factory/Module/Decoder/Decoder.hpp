@@ -35,6 +35,7 @@ struct Decoder : Factory
 		int         n_frames    = 1;
 		int         tail_length = 0;
 		int         flips       = 3;
+		int         ml_threads  = 1;
 		int         seed        = 0;
 
 		// deduced parameters
@@ -8,8 +8,10 @@
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive.hpp"
 #include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp"
@@ -83,6 +85,9 @@ void Decoder_polar::parameters
 	tools::add_arg(args, p, class_name+"p+lists,L",
 		tools::Integer(tools::Positive(), tools::Non_zero()));
 
+	tools::add_arg(args, p, class_name+"p+flips-alpha",
+		tools::Real(tools::Positive()));
+
 	tools::add_arg(args, p, class_name+"p+simd",
 		tools::Text(tools::Including_set("INTRA", "INTER")));
 
@@ -105,6 +110,7 @@ void Decoder_polar::parameters
 
 	if(vals.exist({p+"-ite",         "i"})) this->n_ite         = vals.to_int({p+"-ite",    "i"});
 	if(vals.exist({p+"-lists",       "L"})) this->L             = vals.to_int({p+"-lists",  "L"});
+	if(vals.exist({p+"-flips-alpha"     })) this->flips_alpha   = vals.to_float({p+"-flips-alpha"});
 	if(vals.exist({p+"-simd"            })) this->simd_strategy = vals.at    ({p+"-simd"       });
 	if(vals.exist({p+"-polar-nodes"     })) this->polar_nodes   = vals.at    ({p+"-polar-nodes"});
 	if(vals.exist({p+"-partial-adaptive"})) this->full_adaptive = false;
@@ -129,7 +135,11 @@ void Decoder_polar::parameters
 			headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
 
 		if (this->type == "SCF")
+		{
 			headers[p].push_back(std::make_pair("Num. of flips", std::to_string(this->flips)));
+			if (this->implem == "FAST" && this->flips_alpha > 0.f)
+				headers[p].push_back(std::make_pair("Dynamic flips (alpha)", std::to_string(this->flips_alpha)));
+		}
 
 		if (this->type == "SCL" || this->type == "SCL_MEM")
 			headers[p].push_back(std::make_pair("Num. of lists (L)", std::to_string(this->L)));
@@ -142,6 +152,8 @@ void Decoder_polar::parameters
 		}
 
 		if ((this->type == "SC"      ||
+		     this->type == "SCAN"    ||
+		     this->type == "SCF"     ||
 		     this->type == "SCL"     ||
 		     this->type == "ASCL"    ||
 		     this->type == "SCL_MEM" ||
@@ -157,6 +169,22 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
 	if (this->type == "SCAN" && this->systematic)
 	{
 		if (this->implem == "NAIVE") return new module::Decoder_polar_SCAN_naive_sys<B, Q, tools::f_LLR<Q>, tools::v_LLR<Q>, tools::h_LLR<B,Q>>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
+		if (this->implem == "FAST")
+		{
+			if (this->simd_strategy == "INTER")
+			{
+#ifdef API_POLAR_DYNAMIC
+				using API_polar = tools::API_polar_dynamic_inter<B,Q>;
+#else
+				using API_polar = tools::API_polar_static_inter<B,Q>;
+#endif
+				return _build_siso_scan_fast<B,Q,API_polar>(frozen_bits, encoder);
+			}
+			else if (this->simd_strategy == "INTRA")
+				return _build_siso_scan_fast<B,Q,tools::API_polar_dynamic_intra<B,Q>>(frozen_bits, encoder);
+			else if (this->simd_strategy.empty())
+				return _build_siso_scan_fast<B,Q,tools::API_polar_dynamic_seq<B,Q>>(frozen_bits, encoder);
+		}
 	}
 	else if (this->type == "SCAN" && !this->systematic)
 	{
@@ -166,6 +194,16 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B, typename Q, class API_polar>
+module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
+::_build_siso_scan_fast(const std::vector<bool> &frozen_bits, const std::unique_ptr<module::Encoder<B>>& encoder) const
+{
+	int idx_r0, idx_r1;
+	auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
+
+	return new module::Decoder_polar_SCAN_fast_sys<B, Q, API_polar>(this->K, this->N_cw, this->n_ite, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, this->n_frames);
+}
+
 template <typename B, typename Q, class API_polar>
 module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 ::_build(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, const std::unique_ptr<module::Encoder<B>>& encoder) const
@@ -205,11 +243,16 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 		}
 		else if (this->implem == "FAST")
 		{
+			int idx_r0, idx_r1;
+			auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
 			if (crc == nullptr || crc->get_size() == 0)
 			{
-				int idx_r0, idx_r1;
-				auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
-				if (this->type == "SC"  ) return new module::Decoder_polar_SC_fast_sys<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, this->n_frames);
+				if (this->type == "SC"  ) return new module::Decoder_polar_SC_fast_sys  <B, Q, API_polar>(this->K, this->N_cw,              frozen_bits, std::move(polar_patterns), idx_r0, idx_r1,                                         this->n_frames);
+				if (this->type == "SCAN") return new module::Decoder_polar_SCAN_fast_sys<B, Q, API_polar>(this->K, this->N_cw, this->n_ite, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1,                                         this->n_frames);
+			}
+			else
+			{
+				if (this->type == "SCF" ) return new module::Decoder_polar_SCF_fast_sys <B, Q, API_polar>(this->K, this->N_cw,              frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, *crc, this->flips, this->flips_alpha, this->n_frames);
 			}
 		}
 	}
@@ -276,7 +319,7 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 			}
 		}
 
-		if (this->simd_strategy == "INTER" && this->type == "SC" && this->implem == "FAST")
+		if (this->simd_strategy == "INTER" && (this->type == "SC" || this->type == "SCAN") && this->implem == "FAST")
 		{
 			if (typeid(B) == typeid(signed char))
 			{
@@ -32,6 +32,7 @@ struct Decoder_polar : public Decoder
 		int         n_ite         = 1;
 		int         L             = 8;
 		int         T             = 8;
+		float       flips_alpha   = 0.f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Decoder_polar_prefix);
@@ -61,6 +62,10 @@ struct Decoder_polar : public Decoder
 		module::Decoder_SIHO<B,Q>* _build(const std::vector<bool> &frozen_bits, module::CRC<B> *crc = nullptr,
 		                                  const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
 
+		template <typename B = int, typename Q = float, class API_polar>
+		module::Decoder_SISO_SIHO<B,Q>* _build_siso_scan_fast(const std::vector<bool> &frozen_bits,
+		                                                      const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
+
 		template <typename B = int, typename Q = float, class API_polar>
 		module::Decoder_SIHO<B,Q>* _build_scl_fast(const std::vector<bool> &frozen_bits,
 		                                           module::CRC<B> *crc = nullptr,
@@ -14,12 +14,16 @@
 #include "Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic_std_json.hpp"
 #include "Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra_std.hpp"
 #include "Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra_fast.hpp"
+#include "Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra_generic.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra_fast_x2_SSE.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra_fast_x2_AVX.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra_fast_x4_AVX.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_std.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_fast.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_very_fast.hpp"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_window.hpp"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_generic.hpp"
+#include "Module/Decoder/RSC/BCJR/Subblock/Decoder_RSC_BCJR_subblock.hpp"
 #include "Factory/Module/Decoder/RSC/Decoder_RSC.hpp"
 
 using namespace aff3ct;
@@ -53,7 +57,7 @@ void Decoder_RSC::parameters
 	args.erase({p+"-cw-size", "N"});
 
 	tools::add_options(args.at({p+"-type", "D"}), 0, "BCJR");
-	tools::add_options(args.at({p+"-implem"   }), 0, "GENERIC", "FAST", "VERY_FAST");
+	tools::add_options(args.at({p+"-implem"   }), 0, "GENERIC", "FAST", "VERY_FAST", "WINDOW");
 
 	tools::add_arg(args, p, class_name+"p+simd",
 		tools::Text(tools::Including_set("INTRA", "INTER")));
@@ -69,6 +73,21 @@ void Decoder_RSC::parameters
 
 	tools::add_arg(args, p, class_name+"p+std",
 		tools::Text(tools::Including_set("LTE", "CCSDS")));
+
+	tools::add_arg(args, p, class_name+"p+window",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+warm-up",
+		tools::Integer(tools::Positive()));
+
+	tools::add_arg(args, p, class_name+"p+radix-4",
+		tools::None());
+
+	tools::add_arg(args, p, class_name+"p+blocks",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+blocks-thr",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
 }
 
 void Decoder_RSC::parameters
@@ -78,10 +97,15 @@ void Decoder_RSC::parameters
 
 	auto p = this->get_prefix();
 
-	if(vals.exist({p+"-simd"   })) this->simd_strategy = vals.at({p+"-simd"});
-	if(vals.exist({p+"-max"    })) this->max           = vals.at({p+"-max" });
-	if(vals.exist({p+"-std"    })) this->standard      = vals.at({p+"-std" });
-	if(vals.exist({p+"-no-buff"})) this->buffered      = false;
+	if(vals.exist({p+"-simd"      })) this->simd_strategy = vals.at({p+"-simd"});
+	if(vals.exist({p+"-max"       })) this->max           = vals.at({p+"-max" });
+	if(vals.exist({p+"-std"       })) this->standard      = vals.at({p+"-std" });
+	if(vals.exist({p+"-no-buff"   })) this->buffered      = false;
+	if(vals.exist({p+"-window"    })) this->window        = vals.to_int({p+"-window"    });
+	if(vals.exist({p+"-warm-up"   })) this->warm_up       = vals.to_int({p+"-warm-up"   });
+	if(vals.exist({p+"-radix-4"   })) this->radix4        = true;
+	if(vals.exist({p+"-blocks"    })) this->n_sub_blocks  = vals.to_int({p+"-blocks"    });
+	if(vals.exist({p+"-blocks-thr"})) this->sub_threads   = vals.to_int({p+"-blocks-thr"});
 
 	if (this->standard == "LTE" && !vals.exist({p+"-poly"}))
 		this->poly = {013, 015};
@@ -140,6 +164,19 @@ void Decoder_RSC::parameters
 			headers[p].push_back(std::make_pair(std::string("SIMD strategy"), this->simd_strategy));
 
 		headers[p].push_back(std::make_pair(std::string("Max type"), this->max));
+
+		if (this->implem == "WINDOW")
+		{
+			headers[p].push_back(std::make_pair(std::string("Window size"), std::to_string(this->window)));
+			headers[p].push_back(std::make_pair(std::string("Warm-up size"), std::to_string(this->warm_up)));
+			headers[p].push_back(std::make_pair(std::string("Radix-4"), (this->radix4 ? "on" : "off")));
+		}
+
+		if (this->n_sub_blocks > 1)
+		{
+			headers[p].push_back(std::make_pair(std::string("Sub-blocks"), std::to_string(this->n_sub_blocks)));
+			headers[p].push_back(std::make_pair(std::string("Sub-blocks threads"), std::to_string(this->sub_threads)));
+		}
 	}
 }
 
@@ -172,6 +209,20 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_RSC::parameters
 		if (this->implem == "STD"      ) return new module::Decoder_RSC_BCJR_inter_std      <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 		if (this->implem == "FAST"     ) return new module::Decoder_RSC_BCJR_inter_fast     <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 		if (this->implem == "VERY_FAST") return new module::Decoder_RSC_BCJR_inter_very_fast<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
+		if (this->implem == "WINDOW"   ) return new module::Decoder_RSC_BCJR_inter_window   <B,Q,MAX>(this->K, trellis, this->window, this->warm_up, this->radix4, this->buffered, this->n_frames);
+		if (this->implem == "GENERIC")
+		{
+			switch (trellis[0].size())
+			{
+				case  4: return new module::Decoder_RSC_BCJR_inter_generic<B,Q,MAX, 4>(this->K, trellis, this->buffered, this->n_frames);
+				case  8: return new module::Decoder_RSC_BCJR_inter_generic<B,Q,MAX, 8>(this->K, trellis, this->buffered, this->n_frames);
+				case 16: return new module::Decoder_RSC_BCJR_inter_generic<B,Q,MAX,16>(this->K, trellis, this->buffered, this->n_frames);
+				case 32: return new module::Decoder_RSC_BCJR_inter_generic<B,Q,MAX,32>(this->K, trellis, this->buffered, this->n_frames);
+				case 64: return new module::Decoder_RSC_BCJR_inter_generic<B,Q,MAX,64>(this->K, trellis, this->buffered, this->n_frames);
+				default:
+					break;
+			}
+		}
 	}
 
 	if (this->type == "BCJR" && this->simd_strategy == "INTRA")
@@ -206,6 +257,38 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_RSC::parameters
 			}
 #endif
 		}
+		else if (this->implem == "GENERIC")
+		{
+			switch (trellis[0].size())
+			{
+				case 16: return new module::Decoder_RSC_BCJR_intra_generic<B,Q,MAX,16>(this->K, trellis, this->buffered, this->n_frames);
+				case 32: return new module::Decoder_RSC_BCJR_intra_generic<B,Q,MAX,32>(this->K, trellis, this->buffered, this->n_frames);
+				case 64: return new module::Decoder_RSC_BCJR_intra_generic<B,Q,MAX,64>(this->K, trellis, this->buffered, this->n_frames);
+				default:
+					break;
+			}
+		}
+	}
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
+template <typename B, typename Q, tools::proto_max_i<Q> MAX>
+module::Decoder_SISO_SIHO<B,Q>* Decoder_RSC::parameters
+::_build_siso_subblock(const std::vector<std::vector<int>> &trellis) const
+{
+	if (this->type == "BCJR")
+	{
+		switch (trellis[0].size())
+		{
+			case  4: return new module::Decoder_RSC_BCJR_subblock<B,Q,MAX, 4>(this->K, trellis, this->n_sub_blocks, this->sub_threads, this->buffered, this->n_frames);
+			case  8: return new module::Decoder_RSC_BCJR_subblock<B,Q,MAX, 8>(this->K, trellis, this->n_sub_blocks, this->sub_threads, this->buffered, this->n_frames);
+			case 16: return new module::Decoder_RSC_BCJR_subblock<B,Q,MAX,16>(this->K, trellis, this->n_sub_blocks, this->sub_threads, this->buffered, this->n_frames);
+			case 32: return new module::Decoder_RSC_BCJR_subblock<B,Q,MAX,32>(this->K, trellis, this->n_sub_blocks, this->sub_threads, this->buffered, this->n_frames);
+			case 64: return new module::Decoder_RSC_BCJR_subblock<B,Q,MAX,64>(this->K, trellis, this->n_sub_blocks, this->sub_threads, this->buffered, this->n_frames);
+			default:
+				break;
+		}
 	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
@@ -220,7 +303,13 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_RSC::parameters
 {
 	using QD = typename std::conditional<std::is_same<Q,int8_t>::value,int16_t,Q>::type;
 
-	if (this->simd_strategy.empty())
+	if (this->n_sub_blocks > 1)
+	{
+		if (this->max == "MAX" ) return _build_siso_subblock<B,Q,tools::max_i       <Q>>(trellis);
+		if (this->max == "MAXS") return _build_siso_subblock<B,Q,tools::max_star_i  <Q>>(trellis);
+		if (this->max == "MAXL") return _build_siso_subblock<B,Q,tools::max_linear_i<Q>>(trellis);
+	}
+	else if (this->simd_strategy.empty())
 	{
 		if (this->max == "MAX" ) return _build_siso_seq<B,Q,QD,tools::max       <Q>,tools::max       <QD>>(trellis, stream, n_ite, encoder);
 		if (this->max == "MAXS") return _build_siso_seq<B,Q,QD,tools::max_star  <Q>,tools::max_star  <QD>>(trellis, stream, n_ite, encoder);
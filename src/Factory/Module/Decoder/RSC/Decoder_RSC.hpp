@@ -32,6 +32,11 @@ struct Decoder_RSC : public Decoder
 		std::string      standard      = "LTE";
 		bool             buffered      = true;
 		std::vector<int> poly          = {013, 015};
+		int              window        = 64;
+		int              warm_up       = 32;
+		bool             radix4        = false;
+		int              n_sub_blocks  = 1;
+		int              sub_threads   = 1;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Decoder_RSC_prefix);
@@ -66,6 +71,9 @@ struct Decoder_RSC : public Decoder
 		template <typename B = int, typename Q = float, typename QD = Q, tools::proto_max_i<Q> MAX>
 		module::Decoder_SISO_SIHO<B,Q>* _build_siso_simd(const std::vector<std::vector<int>> &trellis,
 		                                                 const std::unique_ptr<module::Encoder<B>> &encoder = nullptr) const;
+
+		template <typename B = int, typename Q = float, tools::proto_max_i<Q> MAX>
+		module::Decoder_SISO_SIHO<B,Q>* _build_siso_subblock(const std::vector<std::vector<int>> &trellis) const;
 	};
 
 	template <typename B = int, typename Q = float>
@@ -2,6 +2,7 @@
 #include <utility>
 #include <thread>
 
+#include "Tools/Exception/exception.hpp"
 #include "Tools/Documentation/documentation.h"
 #include "Tools/Math/utils.h"
 #include "Factory/Simulation/BFER/BFER.hpp"
@@ -114,6 +115,18 @@ void BFER::parameters
 	tools::add_arg(args, p, class_name+"p+coded",
 		tools::None());
 
+	tools::add_arg(args, p, class_name+"p+ckpt-path",
+		tools::File(tools::openmode::read_write),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+ckpt-freq",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+resume",
+		tools::None(),
+		tools::arg_rank::ADV);
+
 	auto pter = ter->get_prefix();
 
 	tools::add_arg(args, pter, class_name+"p+sigma",
@@ -155,6 +168,16 @@ void BFER::parameters
 	if(vals.exist({p+"-err-trk"      })) this->err_track_enable    = true;
 	if(vals.exist({p+"-coset",    "c"})) this->coset               = true;
 	if(vals.exist({p+"-coded",       })) this->coded_monitoring    = true;
+	if(vals.exist({p+"-ckpt-path"    })) this->ckpt_path           = vals.to_file({p+"-ckpt-path"});
+	if(vals.exist({p+"-ckpt-freq"    })) this->ckpt_freq           = seconds(vals.to_int({p+"-ckpt-freq"}));
+	if(vals.exist({p+"-resume"       })) this->ckpt_resume         = true;
+
+	if (this->ckpt_resume && this->ckpt_path.empty())
+	{
+		std::stringstream message;
+		message << "'" << p << "-resume' requires the '" << p << "-ckpt-path' argument.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 
 	if (this->err_track_revert)
 	{
@@ -217,6 +240,13 @@ void BFER::parameters
 	if (this->err_track_threshold)
 		headers[p].push_back(std::make_pair("Bad frames threshold", std::to_string(this->err_track_threshold)));
 
+	if (!this->ckpt_path.empty())
+	{
+		headers[p].push_back(std::make_pair("Checkpoint path", this->ckpt_path));
+		headers[p].push_back(std::make_pair("Checkpoint freq. (s)", std::to_string(this->ckpt_freq.count())));
+		headers[p].push_back(std::make_pair("Resume", this->ckpt_resume ? "yes" : "no"));
+	}
+
 	if (this->err_track_enable || this->err_track_revert)
 	{
 		std::string path = this->err_track_path + std::string("_$noise.[src,enc,chn]");
@@ -40,6 +40,10 @@ struct BFER : Simulation
 		bool        coded_monitoring    = false;
 		bool        ter_sigma           = false;
 		bool        mnt_mutinfo         = false;
+		std::string ckpt_path           = "";
+		bool        ckpt_resume         = false;
+
+		std::chrono::seconds ckpt_freq = std::chrono::seconds(60);
 
 #ifdef AFF3CT_MPI
 		std::chrono::milliseconds mnt_mpi_comm_freq = std::chrono::milliseconds(1000);
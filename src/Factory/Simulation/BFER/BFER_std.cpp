@@ -1,5 +1,11 @@
+#include <sstream>
+#include <iomanip>
+
+#include "Tools/Documentation/documentation.h"
+#include "Tools/system_functions.h"
 #include "Simulation/BFER/Standard/SystemC/SC_BFER_std.hpp"
 #include "Simulation/BFER/Standard/Threads/BFER_std_threads.hpp"
+#include "Simulation/BFER/Standard/Bench/BFER_std_bench.hpp"
 #include "Factory/Simulation/BFER/BFER_std.hpp"
 
 using namespace aff3ct;
@@ -38,18 +44,126 @@ void BFER_std::parameters
 ::get_description(tools::Argument_map_info &args) const
 {
 	BFER::parameters::get_description(args);
+
+	auto p = this->get_prefix();
+	const std::string class_name = "factory::BFER_std::parameters::";
+
+	tools::add_arg(args, p, class_name+"p+bench",
+		tools::None(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+bench-reps",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+bench-warmup",
+		tools::Integer(tools::Positive()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+bench-tasks",
+		tools::List<std::string>(tools::Text(), tools::Length(1)),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+no-fusion",
+		tools::None(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+autotune",
+		tools::None(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+autotune-time",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+autotune-lat",
+		tools::Integer(tools::Positive()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+autotune-max-fra",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+autotune-cache",
+		tools::Integer(tools::Positive()),
+		tools::arg_rank::ADV);
 }
 
 void BFER_std::parameters
 ::store(const tools::Argument_map_value &vals)
 {
 	BFER::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-bench-reps"  })) this->bench_reps   = vals.to_int             ({p+"-bench-reps"  });
+	if(vals.exist({p+"-bench-warmup"})) this->bench_warmup = vals.to_int             ({p+"-bench-warmup"});
+	if(vals.exist({p+"-bench-tasks" })) this->bench_tasks  = vals.to_list<std::string>({p+"-bench-tasks" });
+
+	if(vals.exist({p+"-no-fusion"   })) this->fusion       = false;
+
+	using namespace std::chrono;
+	if(vals.exist({p+"-autotune-time"   })) this->autotune_time    = milliseconds(vals.to_int({p+"-autotune-time"}));
+	if(vals.exist({p+"-autotune-lat"    })) this->autotune_lat     = microseconds(vals.to_int({p+"-autotune-lat" }));
+	if(vals.exist({p+"-autotune-max-fra"})) this->autotune_max_fra = vals.to_int({p+"-autotune-max-fra"});
+
+	// by default the working set of the chain has to fit in the L2 cache (no limit if its size is unknown)
+	if(vals.exist({p+"-autotune-cache"  })) this->autotune_cache   = (size_t)vals.to_int({p+"-autotune-cache"}) * 1024;
+	else                                    this->autotune_cache   = tools::get_cache_size(2);
+
+	// the auto-tuning parameters imply the auto-tuning mode
+	if(vals.exist({p+"-autotune"}) || vals.exist({p+"-autotune-time"}) || vals.exist({p+"-autotune-lat"}) ||
+	   vals.exist({p+"-autotune-max-fra"}) || vals.exist({p+"-autotune-cache"}))
+		this->autotune = true;
+
+	// the benchmark parameters imply the benchmark mode
+	if(vals.exist({p+"-bench"}) || vals.exist({p+"-bench-reps"}) || vals.exist({p+"-bench-warmup"}) ||
+	   vals.exist({p+"-bench-tasks"}))
+		this->bench = true;
+
+	// the tasks are benchmarked one after the other on the communication chain of the thread 0
+	if (this->bench)
+		this->n_threads = 1;
 }
 
 void BFER_std::parameters
 ::get_headers(std::map<std::string,header_list>& headers, const bool full) const
 {
 	BFER::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	headers[p].push_back(std::make_pair("Fused chn/mdm/qnt", this->fusion ? "on" : "off"));
+
+	if (this->autotune)
+	{
+		const auto lat   = this->autotune_lat.count();
+		const auto cache = this->autotune_cache / 1024;
+
+		headers[p].push_back(std::make_pair("Auto-tuning burst (ms)",   std::to_string(this->autotune_time.count())));
+		headers[p].push_back(std::make_pair("Auto-tuning max. latency", lat   ? std::to_string(lat  ) + " us" : "no limit"));
+		headers[p].push_back(std::make_pair("Auto-tuning cache budget", cache ? std::to_string(cache) + " KB" : "no limit"));
+
+		for (auto &r : this->autotune_res)
+		{
+			std::stringstream res;
+			res << std::fixed << std::setprecision(2) << r.second.first << " Mb/s, " << r.second.second << " us"
+			    << (r.first == this->src->n_frames ? " (selected)" : "");
+			headers[p].push_back(std::make_pair("Auto-tuning F = " + std::to_string(r.first), res.str()));
+		}
+	}
+
+	if (this->bench)
+	{
+
+		std::string tasks = this->bench_tasks.empty() ? "all" : "";
+		for (size_t t = 0; t < this->bench_tasks.size(); t++)
+			tasks += this->bench_tasks[t] + (t < this->bench_tasks.size() -1 ? ", " : "");
+
+		headers[p].push_back(std::make_pair("Benchmark tasks",         tasks                             ));
+		headers[p].push_back(std::make_pair("Benchmark warm-up calls", std::to_string(this->bench_warmup)));
+		headers[p].push_back(std::make_pair("Benchmark timed calls",   std::to_string(this->bench_reps  )));
+	}
 }
 
 const Codec_SIHO::parameters* BFER_std::parameters
@@ -65,7 +179,10 @@ simulation::BFER_std<B,R,Q>* BFER_std::parameters
 #if defined(AFF3CT_SYSTEMC_SIMU)
 	return new simulation::SC_BFER_std<B,R,Q>(*this);
 #else
-	return new simulation::BFER_std_threads<B,R,Q>(*this);
+	if (this->bench)
+		return new simulation::BFER_std_bench<B,R,Q>(*this);
+	else
+		return new simulation::BFER_std_threads<B,R,Q>(*this);
 #endif
 }
 
@@ -2,6 +2,8 @@
 #define FACTORY_SIMULATION_BFER_STD_HPP_
 
 #include <string>
+#include <vector>
+#include <chrono>
 #include <map>
 
 #include "Tools/Arguments/Argument_tools.hpp"
@@ -29,6 +31,21 @@ struct BFER_std : BFER
 	{
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		bool                      bench            = false;
+		int                       bench_reps       = 100;
+		int                       bench_warmup     = 10;
+		std::vector<std::string>  bench_tasks;
+		bool                      fusion           = true; // disabled by the launcher if the chain can't be fused
+		bool                      autotune         = false;
+		int                       autotune_max_fra = 64;
+		size_t                    autotune_cache   = 0; // in bytes, 0 = no limit
+		std::chrono::milliseconds autotune_time    = std::chrono::milliseconds(200);
+		std::chrono::microseconds autotune_lat     = std::chrono::microseconds(0); // 0 = no limit
+
+		// measured throughput (Mb/s) and latency (us) for each tried number of frames, filled by the launcher
+		std::map<int, std::pair<double,double>> autotune_res;
+
 		// module parameters
 		// Codec_SIHO::parameters *cdc = nullptr;
 
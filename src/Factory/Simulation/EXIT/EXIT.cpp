@@ -103,6 +103,13 @@ void EXIT::parameters
 
 	args.add_link({p+"-siga-range"}, {p+"-siga-min", "a"});
 	args.add_link({p+"-siga-range"}, {p+"-siga-max", "A"});
+
+#ifdef AFF3CT_MPI
+	auto pmnt = mnt->get_prefix();
+
+	tools::add_arg(args, pmnt, class_name+"p+mpi-comm-freq",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+#endif
 }
 
 void EXIT::parameters
@@ -123,6 +130,13 @@ void EXIT::parameters
 
 		this->sig_a_range = tools::generate_range({{sig_a_min, sig_a_max}}, sig_a_step);
 	}
+
+#ifdef AFF3CT_MPI
+	auto pmnt = mnt->get_prefix();
+
+	if(vals.exist({pmnt+"-mpi-comm-freq"}))
+		this->mnt_mpi_comm_freq = std::chrono::milliseconds(vals.to_int({pmnt+"-mpi-comm-freq"}));
+#endif
 }
 
 void EXIT::parameters
@@ -145,6 +159,12 @@ void EXIT::parameters
 	if (this->src != nullptr)
 		headers[p].push_back(std::make_pair("Inter frame level", std::to_string(this->src->n_frames)));
 
+#ifdef AFF3CT_MPI
+	if (this->mnt != nullptr)
+		headers[mnt->get_prefix()].push_back(std::make_pair("MPI comm. freq. (ms)",
+		                                                    std::to_string(this->mnt_mpi_comm_freq.count())));
+#endif
+
 	if (this->src != nullptr) { this->src->get_headers(headers, full); }
 	if (this->cdc != nullptr) { this->cdc->get_headers(headers, full); }
 	if (this->mdm != nullptr) { this->mdm->get_headers(headers, full); }
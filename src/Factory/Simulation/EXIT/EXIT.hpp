@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <string>
+#include <chrono>
 #include <map>
 
 #include "Tools/Arguments/Argument_tools.hpp"
@@ -45,6 +46,10 @@ struct EXIT : Simulation
 		// optional parameters
 		std::string snr_type = "ES";
 
+#ifdef AFF3CT_MPI
+		std::chrono::milliseconds mnt_mpi_comm_freq = std::chrono::milliseconds(1000);
+#endif
+
 		// module parameters
 		tools::auto_cloned_unique_ptr<Source      ::parameters> src;
 		tools::auto_cloned_unique_ptr<Codec_SISO  ::parameters> cdc;
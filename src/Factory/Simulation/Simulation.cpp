@@ -79,6 +79,18 @@ void Simulation::parameters
 
 	tools::add_arg(args, p, class_name+"p+seed,S",
 		tools::Integer(tools::Positive()));
+
+	tools::add_arg(args, p, class_name+"p+pin",
+		tools::Text(tools::Including_set("NO", "COMPACT", "SCATTER")),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+pin-list",
+		tools::List<int>(tools::Integer(tools::Positive()), tools::Length(1)),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+pin-no-smt",
+		tools::None(),
+		tools::arg_rank::ADV);
 }
 
 void Simulation::parameters
@@ -99,6 +111,13 @@ void Simulation::parameters
 	if(vals.exist({p+"-stats"         })) this->statistics  = true;
 	if(vals.exist({p+"-dbg"           })) this->debug       = true;
 	if(vals.exist({p+"-crit-nostop"   })) this->crit_nostop = true;
+	if(vals.exist({p+"-pin"           })) this->pin_policy  =         vals.at    ({p+"-pin"         });
+	if(vals.exist({p+"-pin-no-smt"    })) this->pin_no_smt  = true;
+	if(vals.exist({p+"-pin-list"      }))
+	{
+		this->pin_policy = "LIST";
+		this->pin_list   = vals.to_list<int>({p+"-pin-list"});
+	}
 	if(vals.exist({p+"-dbg-limit", "d"}))
 	{
 		this->debug = true;
@@ -180,6 +199,18 @@ void Simulation::parameters
 
 	headers[p].push_back(std::make_pair("Multi-threading (t)", threads));
 
+	std::string pinning = this->pin_policy;
+	if (this->pin_policy == "LIST")
+	{
+		pinning += " (";
+		for (size_t c = 0; c < this->pin_list.size(); c++)
+			pinning += std::to_string(this->pin_list[c]) + (c < this->pin_list.size() -1 ? "," : ")");
+	}
+	if (this->pin_policy != "NO" && this->pin_no_smt)
+		pinning += ", no SMT";
+
+	headers[p].push_back(std::make_pair("Thread pinning", pinning));
+
 #ifdef AFF3CT_MPI
 	headers[p].push_back(std::make_pair("MPI size", std::to_string(this->mpi_size)));
 #endif
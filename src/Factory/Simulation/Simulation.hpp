@@ -3,6 +3,7 @@
 
 #include <chrono>
 #include <string>
+#include <vector>
 #include <map>
 
 #include "Tools/Arguments/Argument_tools.hpp"
@@ -28,11 +29,14 @@ struct Simulation : Launcher
 		// optional parameters
 		std::chrono::seconds stop_time       = std::chrono::seconds(0);
 		std::string          meta            = "";
+		std::string          pin_policy      = "NO";
+		std::vector<int>     pin_list;
 		unsigned             max_frame       = 0;
 		bool                 debug           = false;
 		bool                 debug_hex       = false;
 		bool                 statistics      = false;
 		bool                 crit_nostop     = false;
+		bool                 pin_no_smt      = false;
 		int                  n_threads       = 1;
 		int                  local_seed      = 0;
 		int                  global_seed     = 0;
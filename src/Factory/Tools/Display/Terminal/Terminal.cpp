@@ -3,6 +3,7 @@
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Documentation/documentation.h"
 #include "Tools/Display/Terminal/Standard/Terminal_std.hpp"
+#include "Tools/Display/Terminal/Metrics/Terminal_metrics.hpp"
 #include "Factory/Tools/Display/Terminal/Terminal.hpp"
 
 using namespace aff3ct;
@@ -43,6 +44,14 @@ void Terminal::parameters
 
 	tools::add_arg(args, p, class_name+"p+freq",
 		tools::Integer(tools::Positive()));
+
+	tools::add_arg(args, p, class_name+"p+json",
+		tools::File(tools::openmode::write),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+sock",
+		tools::Text(),
+		tools::arg_rank::ADV);
 }
 
 void Terminal::parameters
@@ -53,6 +62,8 @@ void Terminal::parameters
 	if(vals.exist({p+"-type"})) this->type      = vals.at({p+"-type"});
 	if(vals.exist({p+"-no"  })) this->disabled  = true;
 	if(vals.exist({p+"-freq"})) this->frequency = std::chrono::milliseconds(vals.to_int({p+"-freq"}));
+	if(vals.exist({p+"-json"})) this->json_path = vals.to_file({p+"-json"});
+	if(vals.exist({p+"-sock"})) this->sock_path = vals.at({p+"-sock"});
 }
 
 void Terminal::parameters
@@ -62,19 +73,31 @@ void Terminal::parameters
 
 	headers[p].push_back(std::make_pair("Enabled", this->disabled ? "no" : "yes"));
 	headers[p].push_back(std::make_pair("Frequency (ms)", std::to_string(this->frequency.count())));
+	if (!this->json_path.empty())
+		headers[p].push_back(std::make_pair("Metrics file", this->json_path));
+	if (!this->sock_path.empty())
+		headers[p].push_back(std::make_pair("Metrics socket", this->sock_path));
 }
 
 
 tools::Terminal* Terminal::parameters
-::build(const std::vector<std::unique_ptr<tools::Reporter>> &reporters) const
+::build(const std::vector<std::unique_ptr<tools::Reporter>> &reporters,
+        const std::map<std::string, std::vector<const module::Module*>> *modules) const
 {
-	if (this->type == "STD") return new tools::Terminal_std(reporters);
+	if (this->type == "STD")
+	{
+		if (!this->json_path.empty() || !this->sock_path.empty())
+			return new tools::Terminal_metrics(reporters, this->json_path, this->sock_path, modules);
+		else
+			return new tools::Terminal_std(reporters);
+	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
 tools::Terminal* Terminal
-::build(const parameters &params, const std::vector<std::unique_ptr<tools::Reporter>> &reporters)
+::build(const parameters &params, const std::vector<std::unique_ptr<tools::Reporter>> &reporters,
+        const std::map<std::string, std::vector<const module::Module*>> *modules)
 {
-	return params.build(reporters);
+	return params.build(reporters, modules);
 }
\ No newline at end of file
@@ -2,10 +2,12 @@
 #define FACTORY_TERMINAL_HPP_
 
 #include <chrono>
+#include <vector>
 #include <string>
 #include <map>
 
 #include "Tools/Arguments/Argument_tools.hpp"
+#include "Module/Module.hpp"
 #include "Tools/Display/Terminal/Terminal.hpp"
 #include "Tools/Display/Reporter/Reporter.hpp"
 #include "Factory/Factory.hpp"
@@ -26,6 +28,8 @@ struct Terminal : Factory
 		std::string               type      = "STD";
 		std::chrono::milliseconds frequency = std::chrono::milliseconds(500);
 		bool                      disabled  = false;
+		std::string               json_path = "";
+		std::string               sock_path = "";
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		parameters(const std::string &p = Terminal_prefix);
@@ -38,13 +42,15 @@ struct Terminal : Factory
 		virtual void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
 
 		// builder
-		tools::Terminal* build(const std::vector<std::unique_ptr<tools::Reporter>> &reporters) const;
+		tools::Terminal* build(const std::vector<std::unique_ptr<tools::Reporter>> &reporters,
+		                       const std::map<std::string, std::vector<const module::Module*>> *modules = nullptr) const;
 
 	protected:
 		parameters(const std::string &n, const std::string &p);
 	};
 
-	static tools::Terminal* build(const parameters &params, const std::vector<std::unique_ptr<tools::Reporter>> &reporters);
+	static tools::Terminal* build(const parameters &params, const std::vector<std::unique_ptr<tools::Reporter>> &reporters,
+	                              const std::map<std::string, std::vector<const module::Module*>> *modules = nullptr);
 };
 }
 }
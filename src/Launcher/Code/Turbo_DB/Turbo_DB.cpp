@@ -1,4 +1,5 @@
 #include <type_traits>
+#include <mipp.h>
 
 #include "Launcher/Simulation/BFER_std.hpp"
 #include "Factory/Module/Codec/Turbo_DB/Codec_turbo_DB.hpp"
@@ -42,6 +43,9 @@ void Turbo_DB<L,B,R,Q>
 
 	params_cdc->store(this->arg_vals);
 
+	if (dec_tur->sub->simd_strategy == "INTER")
+		this->params.src->n_frames = mipp::N<Q>();
+
 	if (std::is_same<Q,int8_t>())
 	{
 		this->params.qnt->n_bits     = 6;
@@ -52,6 +52,10 @@ void Launcher::store_args()
 {
 }
 
+void Launcher::autotune()
+{
+}
+
 int Launcher::read_arguments()
 {
 	this->get_description_args();
@@ -163,6 +167,16 @@ int Launcher::launch()
 		return EXIT_FAILURE;
 	}
 
+	try
+	{
+		this->autotune();
+	}
+	catch(const std::exception& e)
+	{
+		rang::format_on_each_line(std::cerr, std::string(e.what()) + "\n", rang::tag::error);
+		return EXIT_FAILURE;
+	}
+
 	// write the command and he curve name in the PyBER format
 #ifdef AFF3CT_MPI
 	if (this->params_common.mpi_rank == 0)
@@ -83,6 +83,14 @@ protected:
 	 */
 	virtual void store_args();
 
+	/*!
+	 * \brief Tunes the parameters at startup with measurements, called after 'store_args()' and before the display
+	 *        of the parameters. Does nothing by default.
+	 *
+	 * This method can be overloaded to be extended.
+	 */
+	virtual void autotune();
+
 	/*!
 	 * \brief Allocates a specific simulation.
 	 *
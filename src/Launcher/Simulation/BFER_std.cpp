@@ -1,12 +1,15 @@
 #include <type_traits>
 #include <string>
+#include <memory>
 
 #include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Display/Terminal/Terminal.hpp"
 #include "Factory/Module/Monitor/BFER/Monitor_BFER.hpp"
 #include "Factory/Module/Monitor/MI/Monitor_MI.hpp"
 #include "Factory/Module/Interleaver/Interleaver.hpp"
 
 #include "Simulation/BFER/Standard/BFER_std.hpp"
+#include "Simulation/BFER/Standard/Tune/BFER_std_tune.hpp"
 
 #include "Launcher/Simulation/BFER_std.hpp"
 
@@ -138,6 +141,10 @@ void BFER_std<B,R,Q>
 
 	params.ter->store(this->arg_vals);
 
+	// the benchmark reports its own results, the BER/FER terminal would be meaningless
+	if (params.bench)
+		params.ter->disabled = true;
+
 	if (!std::is_integral<Q>())
 		params.qnt->type = "NO";
 
@@ -203,6 +210,27 @@ void BFER_std<B,R,Q>
 	params.mnt_er->max_frame = params.max_frame;
 	params.mnt_mi->n_trials  = 0;
 
+	// the AWGN channel, the BPSK demodulation and the quantization are fused in a single quantizer task when the
+	// intermediate noisy signal and LLRs are not needed by another module
+#if defined(AFF3CT_SYSTEMC_SIMU)
+	params.fusion = false;
+#else
+	params.fusion = params.fusion                       &&
+	                std::is_same<R,float>::value        &&
+	                std::is_integral<Q>::value          &&
+	                params.chn->type         == "AWGN"  &&
+	                params.chn->implem       == "FAST"  &&
+	                params.chn->block_fading == "NO"    &&
+	                !params.chn->add_users              &&
+	                params.mdm->type         == "BPSK"  &&
+	                params.qnt->type         == "POW2"  &&
+	                params.noise->type       != "ROP"   &&
+	                params.noise->type       != "EP"    &&
+	                !params.err_track_enable            &&
+	                !params.err_track_revert            &&
+	                !params.mnt_mutinfo;
+#endif
+
 #ifdef AFF3CT_MPI
 	auto pter = params.ter->get_prefix();
 	if (!this->arg_vals.exist({pter+"-freq"}))
@@ -215,6 +243,91 @@ void BFER_std<B,R,Q>
 #endif
 }
 
+template <typename B, typename R, typename Q>
+void BFER_std<B,R,Q>
+::autotune()
+{
+	if (!params.autotune)
+		return;
+
+#if defined(AFF3CT_MPI) || defined(AFF3CT_SYSTEMC_SIMU)
+	params.autotune = false;
+	std::clog << rang::tag::warning << "The auto-tuning of the number of frames is not available with MPI or SystemC, "
+	          << "it is disabled." << std::endl;
+#else
+	if (params.err_track_revert)
+	{
+		params.autotune = false;
+		std::clog << rang::tag::warning << "The auto-tuning of the number of frames can't be used when the bad frames "
+		          << "are replayed, it is disabled." << std::endl;
+		return;
+	}
+
+	const tools::Argument_tag tag_fra = {params.src->get_prefix()+"-fra", "F"};
+	auto* info_fra = this->args.exist(tag_fra) ? this->args.at(tag_fra) : nullptr;
+
+	const auto arg_vals_save = this->arg_vals;
+	const auto base          = params.src->n_frames; // given by the user or the SIMD inter-frame level of the decoder
+	      auto best_fra      = base;
+	      auto best_thr      = 0.;
+
+	params.autotune_res.clear();
+	for (auto F = base; ; F *= 2)
+	{
+		// propagate the number of frames to all the modules parameters (as with the '-F' argument)
+		this->arg_vals[tag_fra] = std::make_pair(std::to_string(F), info_fra);
+		this->store_args();
+
+		// the chain is measured on a single thread, at the first noise point and without any output
+		std::unique_ptr<factory::BFER_std::parameters> params_tune(params.clone());
+		params_tune->n_threads         = 1;
+		params_tune->bench             = false;
+		params_tune->debug             = false;
+		params_tune->statistics        = false;
+		params_tune->display_legend    = false;
+		params_tune->err_track_enable  = false;
+		params_tune->ckpt_path         = "";
+		params_tune->ckpt_resume       = false;
+		params_tune->stop_time         = std::chrono::seconds(0);
+		params_tune->max_frame         = 0;
+		params_tune->mnt_er->max_frame = 0;
+		params_tune->mnt_er->err_hist  = -1;
+		params_tune->ter->disabled     = true;
+		params_tune->noise->range      = {params.noise->type == "EP" ? params.noise->range.back()
+		                                                             : params.noise->range.front()};
+
+		simulation::BFER_std_tune<B,R,Q> simu(*params_tune, params.autotune_time);
+		simu.launch();
+
+		if (simu.is_error() || tools::Terminal::is_over())
+			break;
+
+		const auto thr = simu.get_throughput();
+		const auto lat = simu.get_latency();
+		params.autotune_res[F] = std::make_pair(thr, lat);
+
+		const auto lat_ok   = !params.autotune_lat.count() || lat <= (double)params.autotune_lat.count();
+		const auto cache_ok = !params.autotune_cache || simu.get_working_set() <= params.autotune_cache;
+
+		// the default number of frames is always a valid choice, a bigger one has to be faster in the limits
+		if (F != base && (!lat_ok || !cache_ok || thr <= best_thr))
+			break;
+
+		best_fra = F;
+		best_thr = thr;
+
+		// more frames per call only increase the latency and the working set
+		if (!lat_ok || !cache_ok || F * 2 > params.autotune_max_fra)
+			break;
+	}
+
+	this->arg_vals = arg_vals_save;
+	if (best_fra != base)
+		this->arg_vals[tag_fra] = std::make_pair(std::to_string(best_fra), info_fra);
+	this->store_args();
+#endif
+}
+
 template <typename B, typename R, typename Q>
 simulation::Simulation* BFER_std<B,R,Q>
 ::build_simu()
@@ -25,6 +25,13 @@ protected:
 	virtual void get_description_args();
 	virtual void store_args();
 
+	/*!
+	 * \brief Chooses the number of frames per call (if '--sim-autotune'): the chain is built with 1, 2, 4, ... times
+	 *        the default number of frames (the SIMD inter-frame level of the decoder), its throughput is measured on a
+	 *        short burst and the fastest configuration in the latency and the cache limits is kept.
+	 */
+	virtual void autotune();
+
 	virtual simulation::Simulation* build_simu();
 };
 }
@@ -3,6 +3,7 @@
 #include <string>
 
 #include "Tools/Algo/Draw_generator/Event_generator/Standard/Event_generator_std.hpp"
+#include "Tools/Algo/Draw_generator/Event_generator/Sparse/Event_generator_sparse.hpp"
 #include "Tools/Noise/noise_utils.h"
 #include "Module/Channel/Binary_erasure/Channel_binary_erasure.hpp"
 
@@ -21,7 +22,9 @@ template<typename R>
 Channel_binary_erasure<R>
 ::Channel_binary_erasure(const int N, std::unique_ptr<tools::Event_generator<R>>&& event_generator,
                          const tools::Event_probability<R> &noise, const int n_frames)
-: Channel<R>(N, noise, n_frames), event_generator(std::move(event_generator))
+: Channel<R>(N, noise, n_frames), event_generator(std::move(event_generator)),
+  sparse_generator(dynamic_cast<tools::Event_generator_sparse<R>*>(this->event_generator.get())),
+  drawn_positions(this->n_frames), sparse_draw(this->n_frames, true)
 {
 	const std::string name = "Channel_binary_erasure";
 	this->set_name(name);
@@ -36,7 +39,34 @@ void Channel_binary_erasure<R>
 	auto event_draw = (E*)(this->noise.data() + this->N * frame_id);
 
 	const auto event_probability = this->n->get_noise();
+
+	if (sparse_generator != nullptr && sparse_generator->is_sparse(event_probability))
+	{
+		// only the erased positions are drawn and touched
+		auto &positions = this->drawn_positions[frame_id];
+
+		// the event draw is kept cleared between the frames: only the previous events have to be reset
+		if (this->sparse_draw[frame_id])
+			for (auto p : positions)
+				event_draw[p] = (E)false;
+		else
+			std::fill(event_draw, event_draw + this->N, (E)false);
+
+		positions = sparse_generator->generate_positions((unsigned)this->N, event_probability);
+		this->sparse_draw[frame_id] = true;
+
+		if (X_N != Y_N)
+			std::copy(X_N, X_N + this->N, Y_N);
+		for (auto p : positions)
+		{
+			event_draw[p] = (E)true;
+			Y_N[p] = tools::unknown_symbol_val<R>();
+		}
+		return;
+	}
+
 	event_generator->generate(event_draw, (unsigned)this->N, event_probability);
+	this->sparse_draw[frame_id] = false;
 
 	const mipp::Reg<R> r_erased = tools::unknown_symbol_val<R>();
 	const mipp::Reg<E> r_false  = (E)false;
@@ -2,9 +2,11 @@
 #define CHANNEL_BEC_HPP_
 
 #include <memory>
+#include <vector>
 
 #include "Tools/types.h"
 #include "Tools/Algo/Draw_generator/Event_generator/Event_generator.hpp"
+#include "Tools/Algo/Draw_generator/Event_generator/Sparse/Event_generator_sparse.hpp"
 #include "Tools/Noise/Event_probability.hpp"
 #include "Module/Channel/User/Channel_user_be.hpp"
 
@@ -17,6 +19,9 @@ class Channel_binary_erasure : public Channel<R>
 {
 protected:
 	std::unique_ptr<tools::Event_generator<R>> event_generator;
+	tools::Event_generator_sparse<R>*          sparse_generator; // not null if 'event_generator' is a sparse one
+	std::vector<std::vector<unsigned>>         drawn_positions;  // per frame, the events set in 'noise' by the sparse path
+	std::vector<bool>                          sparse_draw;      // per frame, true if 'noise' only holds 'drawn_positions'
 
 	using E = typename tools::matching_types<R>::B;
 
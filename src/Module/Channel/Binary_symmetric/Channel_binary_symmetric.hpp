@@ -2,8 +2,10 @@
 #define CHANNEL_BSC_HPP_
 
 #include <memory>
+#include <vector>
 
 #include "Tools/Algo/Draw_generator/Event_generator/Event_generator.hpp"
+#include "Tools/Algo/Draw_generator/Event_generator/Sparse/Event_generator_sparse.hpp"
 #include "Tools/Noise/Event_probability.hpp"
 #include "Module/Channel/Channel.hpp"
 
@@ -16,6 +18,9 @@ class Channel_binary_symmetric : public Channel<R>
 {
 protected:
 	std::unique_ptr<tools::Event_generator<R>> event_generator;
+	tools::Event_generator_sparse<R>*          sparse_generator; // not null if 'event_generator' is a sparse one
+	std::vector<std::vector<unsigned>>         drawn_positions;  // per frame, the events set in 'noise' by the sparse path
+	std::vector<bool>                          sparse_draw;      // per frame, true if 'noise' only holds 'drawn_positions'
 
 	using E = typename tools::matching_types<R>::B; //Event type
 
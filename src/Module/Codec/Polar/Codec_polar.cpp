@@ -164,10 +164,11 @@ void Codec_polar<B,Q>
 {
 	if (this->N_cw != this->N && puncturer_shortlast)
 		puncturer_shortlast->gen_frozen_bits(frozen_bits);
-	if (this->fb_decoder)
-		this->fb_decoder->notify_frozenbits_update();
+	// the encoder goes first: some decoders are built from it (Chase, ML)
 	if (this->fb_encoder)
 		this->fb_encoder->notify_frozenbits_update();
+	if (this->fb_decoder)
+		this->fb_decoder->notify_frozenbits_update();
 }
 
 template <typename B, typename Q>
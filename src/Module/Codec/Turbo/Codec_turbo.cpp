@@ -108,9 +108,18 @@ Codec_turbo<B,Q>
 	}
 	catch (tools::cannot_allocate const&)
 	{
-		sub_dec      .reset(factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream, dec_params.n_ite));
+		sub_dec_n.reset(factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream, dec_params.n_ite));
+
+		// the SISO decoders keep metrics from one iteration to the next (NII), so each domain needs its own, except
+		// for the JSON dump which traces the natural and the interleaved domains alternately
+		if (dec_params.sub1->implem == "GENERIC_JSON")
+			sub_dec_i = sub_dec_n;
+		else
+			sub_dec_i.reset(factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream,
+			                                                      dec_params.n_ite));
+
 		decoder_turbo.reset(factory::Decoder_turbo::build<B,Q>(dec_params, this->get_interleaver_llr(),
-		                                                       *sub_dec, *sub_dec, this->get_encoder()));
+		                                                       *sub_dec_n, *sub_dec_i, this->get_encoder()));
 		this->set_decoder_siho(std::static_pointer_cast<Decoder_SIHO<B,Q>>(decoder_turbo));
 	}
 
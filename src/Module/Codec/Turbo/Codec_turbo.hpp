@@ -25,7 +25,8 @@ class Codec_turbo : public Codec_SIHO<B,Q>
 protected:
 	std::vector<std::vector<int>>                                  trellis;
 	std::shared_ptr<module::Encoder_RSC_sys<B>>                    sub_enc;
-	std::shared_ptr<module::Decoder_SISO   <Q>>                    sub_dec;
+	std::shared_ptr<module::Decoder_SISO   <Q>>                    sub_dec_n;
+	std::shared_ptr<module::Decoder_SISO   <Q>>                    sub_dec_i;
 	std::vector<std::shared_ptr<tools::Post_processing_SISO<B,Q>>> post_pros;
 	std::ofstream                                                  json_stream;
 
@@ -31,7 +31,8 @@ Decoder_BCH_fast<B,R>
   m               (GF_poly.get_m()                                         ),
   d               (GF_poly.get_d()                                         ),
   alpha_to        (GF_poly.get_alpha_to()                                  ),
-  index_of        (GF_poly.get_index_of()                                  )
+  index_of        (GF_poly.get_index_of()                                  ),
+  square          (tools::Galois_linear_map<B>::square(GF_poly.get_alpha_to()))
 {
 	const std::string name = "Decoder_BCH_fast";
 	this->set_name(name);
@@ -106,18 +107,26 @@ void Decoder_BCH_fast<B,R>
 
 	std::fill(s.begin(), s.end(), r_zero);
 
-	for (auto i = 1; i <= t2; i++)
+	// only the odd syndromes are computed, the even ones are s_2i = (s_i)^2 for a binary word
+	for (auto i = 1; i <= t2; i += 2)
 	{
-		for (auto j = 0; j < this->N; j++)
+		for (auto j = 0, e = 0; j < this->N; j++)
 		{
-			const mipp::Reg<B> r_alpha = alpha_to[(i * j) % this->N_p2_1];
+			const mipp::Reg<B> r_alpha = alpha_to[e];
 			s[i] ^= mipp::blend(r_alpha, r_zero, Y_N_reorderered[j] != r_zero);
+
+			e += i; // e = (i * j) % N_p2_1
+			if (e >= this->N_p2_1) e -= this->N_p2_1;
 		}
 
 		syn_error |= s[i] != r_zero;
+	}
 
+	for (auto i = 2; i <= t2; i += 2)
+		s[i] = square.apply(s[i / 2]);
+
+	for (auto i = 1; i <= t2; i++)
 		s[i] = read_array(index_of, s[i]);
-	}
 
 
 	if (!mipp::testz(syn_error))
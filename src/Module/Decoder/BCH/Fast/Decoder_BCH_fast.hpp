@@ -5,6 +5,7 @@
 #include <mipp.h>
 
 #include "Tools/Code/BCH/BCH_polynomial_generator.hpp"
+#include "Tools/Math/Galois_kernels.hpp"
 #include "Module/Decoder/BCH/Decoder_BCH.hpp"
 
 namespace aff3ct
@@ -33,6 +34,8 @@ protected:
 	const std::vector<B>& alpha_to; // log table of GF(2**m)
 	const std::vector<B>& index_of; // antilog table of GF(2**m)
 
+	const tools::Galois_linear_map<B> square; // squaring in GF(2**m) (even syndromes)
+
 
 public:
 	Decoder_BCH_fast(const int& K, const int& N, const tools::BCH_polynomial_generator<B> &GF, const int n_frames = 1);
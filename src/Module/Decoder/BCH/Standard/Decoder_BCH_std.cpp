@@ -15,7 +15,7 @@ Decoder_BCH_std<B, R>
 : Decoder         (K, N,                  n_frames, 1),
   Decoder_BCH<B,R>(K, N, GF_poly.get_t(), n_frames),
   t2(2 * this->t), YH_N(N),
-  elp(this->N_p2_1+2, std::vector<int>(this->N_p2_1)), discrepancy(this->N_p2_1+2), l(this->N_p2_1+2), u_lu(this->N_p2_1+2), s(t2+1), loc(this->t +1), reg(this->t +1),
+  elp(this->N_p2_1+2, std::vector<int>(this->N_p2_1)), discrepancy(this->N_p2_1+2), l(this->N_p2_1+2), u_lu(this->N_p2_1+2), s(t2+1), loc(this->t +1), reg(this->t +1), pos(N),
   m(GF_poly.get_m()), d(GF_poly.get_d()), alpha_to(GF_poly.get_alpha_to()), index_of(GF_poly.get_index_of())
 {
 	const std::string name = "Decoder_BCH_std";
@@ -34,20 +34,14 @@ template <typename B, typename R>
 void Decoder_BCH_std<B, R>
 ::_decode(B *Y_N, const int frame_id)
 {
-	int i, j, syn_error = 0;
+	int i, j;
 
 	/* first form the syndromes */
+	const auto syn_error = tools::gf2_syndromes(Y_N, this->N, alpha_to, index_of, t2, s.data(), pos.data());
+
+	/* convert syndrome from polynomial form to index form  */
 	for (i = 1; i <= t2; i++)
-	{
-		s[i] = 0;
-		for (j = 0; j < this->N; j++)
-			if (Y_N[j] != 0)
-				s[i] ^= alpha_to[(i * j) % this->N_p2_1];
-		if (s[i] != 0)
-			syn_error = 1; /* set error flag if non-zero syndrome */
-		/* convert syndrome from polynomial form to index form  */
 		s[i] = (int)index_of[s[i]];
-	}
 
 	this->last_is_codeword[frame_id] = !syn_error;
 
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "Tools/Code/BCH/BCH_polynomial_generator.hpp"
+#include "Tools/Math/Galois_kernels.hpp"
 #include "Module/Decoder/BCH/Decoder_BCH.hpp"
 
 namespace aff3ct
@@ -25,6 +26,7 @@ protected:
 	std::vector<int> s;
 	std::vector<int> loc;
 	std::vector<int> reg;
+	std::vector<int> pos; // positions of the bits set in the received word
 
 	const int m;               // order of the Galois Field
 	const int d;               // minimum distance of the code (d=2t+1))
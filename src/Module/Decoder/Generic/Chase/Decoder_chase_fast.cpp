@@ -0,0 +1,190 @@
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <numeric>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/common/hard_decide.h"
+
+#include "Module/Decoder/Generic/Chase/Decoder_chase_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_chase_fast<B,R>
+::Decoder_chase_fast(const int K, const int N, Encoder<B> &encoder, const uint32_t max_flips, const bool hamming,
+                     const int n_frames)
+: Decoder                (K, N,                               n_frames, 1),
+  Decoder_chase_std<B,R> (K, N, encoder, max_flips, hamming, n_frames   ),
+  n_words((N - K + 63) / 64),
+  synd_contrib(N * n_words, 0),
+  synd(n_words, 0)
+{
+	const std::string name = "Decoder_chase_fast";
+	this->set_name(name);
+
+	if (!encoder.is_sys())
+	{
+		std::stringstream message;
+		message << "'encoder.is_sys()' has to be true.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (encoder.get_K() != K)
+	{
+		std::stringstream message;
+		message << "'encoder.get_K()' has to be equal to 'K' ('encoder.get_K()' = " << encoder.get_K()
+		        << ", 'K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (encoder.get_N() != N)
+	{
+		std::stringstream message;
+		message << "'encoder.get_N()' has to be equal to 'N' ('encoder.get_N()' = " << encoder.get_N()
+		        << ", 'N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->init_syndromes();
+}
+
+template <typename B, typename R>
+void Decoder_chase_fast<B,R>
+::notify_frozenbits_update()
+{
+	this->init_syndromes();
+}
+
+template <typename B, typename R>
+void Decoder_chase_fast<B,R>
+::init_syndromes()
+{
+	const auto &info_bits_pos = this->encoder.get_info_bits_pos();
+
+	std::fill(this->synd_contrib.begin(), this->synd_contrib.end(), (uint64_t)0);
+
+	// the syndrome of a word is the XOR between its parity bits and the parity bits obtained by re-encoding its
+	// information bits, it is null only for the codewords
+	std::vector<int> parity_idx(this->N, -1);
+	std::vector<bool> is_info(this->N, false);
+	for (auto k = 0; k < this->K; k++)
+		is_info[info_bits_pos[k]] = true;
+	for (auto n = 0, p = 0; n < this->N; n++)
+		if (!is_info[n])
+			parity_idx[n] = p++;
+
+	// contribution of a parity bit: itself
+	for (auto n = 0; n < this->N; n++)
+		if (parity_idx[n] >= 0)
+			synd_contrib[n * n_words + parity_idx[n] / 64] |= (uint64_t)1 << (parity_idx[n] % 64);
+
+	// contribution of an information bit: the parity part of the corresponding generator row
+	std::vector<B> U_K(this->K, (B)0), X_N(this->N);
+	for (auto k = 0; k < this->K; k++)
+	{
+		U_K[k] = (B)1;
+		this->encoder.encode(U_K.data(), X_N.data(), 0);
+		U_K[k] = (B)0;
+
+		const auto i = info_bits_pos[k];
+		for (auto n = 0; n < this->N; n++)
+			if (parity_idx[n] >= 0 && X_N[n])
+				synd_contrib[i * n_words + parity_idx[n] / 64] |= (uint64_t)1 << (parity_idx[n] % 64);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_chase_fast<B,R>
+::flip_syndrome(const uint32_t n)
+{
+	const auto contrib = this->synd_contrib.data() + n * this->n_words;
+	for (auto w = 0; w < this->n_words; w++)
+		this->synd[w] ^= contrib[w];
+}
+
+template <typename B, typename R>
+bool Decoder_chase_fast<B,R>
+::is_syndrome_null() const
+{
+	for (auto w = 0; w < this->n_words; w++)
+		if (this->synd[w])
+			return false;
+	return true;
+}
+
+template <typename B, typename R>
+void Decoder_chase_fast<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	tools::hard_decide(Y_N, V_N, this->N);
+
+	std::fill(this->synd.begin(), this->synd.end(), (uint64_t)0);
+	for (auto n = 0; n < this->N; n++)
+		if (V_N[n])
+			this->flip_syndrome(n);
+
+	if (!this->max_flips || this->is_syndrome_null())
+		return;
+
+	std::iota(this->less_reliable_llrs.begin(), this->less_reliable_llrs.end(), 0);
+
+	std::partial_sort(this->less_reliable_llrs.begin(),
+	                  this->less_reliable_llrs.begin() + this->max_flips,
+	                  this->less_reliable_llrs.end(),
+	                  [&Y_N](const uint32_t i1, const uint32_t i2) {
+		return std::abs(Y_N[i1]) < std::abs(Y_N[i2]);
+	});
+
+	// walk the test patterns in the Gray code order
+	auto     min_dist = std::numeric_limits<float>::max();
+	uint32_t pattern  = 0;
+	this->best_test   = 0;
+
+	const uint32_t max = 1 << this->max_flips;
+	for (uint32_t t = 1; t < max; t++)
+	{
+		// the bit to flip is given by the position of the lowest bit set in 't'
+		uint32_t b = 0;
+		while (!((t >> b) & 1))
+			b++;
+
+		pattern ^= 1 << b;
+
+		this->flip_syndrome(this->less_reliable_llrs[b]);
+
+		if (!this->is_syndrome_null())
+			continue;
+
+		// the distance is summed in the same order as the standard implementation (no incremental rounding error)
+		auto cur_dist = 0.f;
+		for (size_t f = 0; f < this->max_flips; f++)
+			if ((pattern >> f) & 1)
+				cur_dist += this->hamming ? 1.f : (float)std::abs(Y_N[this->less_reliable_llrs[f]]);
+
+		// on equal distances, keep the same test pattern as the standard implementation
+		if (cur_dist < min_dist || (cur_dist == min_dist && pattern < this->best_test))
+		{
+			min_dist        = cur_dist;
+			this->best_test = pattern;
+		}
+	}
+
+	for (size_t b = 0; b < this->max_flips; b++)
+		if ((this->best_test >> b) & 1)
+			V_N[this->less_reliable_llrs[b]] = !V_N[this->less_reliable_llrs[b]];
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_chase_fast<B_8,Q_8>;
+template class aff3ct::module::Decoder_chase_fast<B_16,Q_16>;
+template class aff3ct::module::Decoder_chase_fast<B_32,Q_32>;
+template class aff3ct::module::Decoder_chase_fast<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_chase_fast<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
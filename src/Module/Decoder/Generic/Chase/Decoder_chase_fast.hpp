@@ -0,0 +1,53 @@
+#ifndef DECODER_CHASE_FAST_HPP_
+#define DECODER_CHASE_FAST_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+#include "Module/Encoder/Encoder.hpp"
+#include "Module/Decoder/Generic/Chase/Decoder_chase_std.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_chase_fast
+ *
+ * \brief Chase decoder working on the syndromes of the test patterns (linear and systematic codes only).
+ *
+ * The syndrome contribution of each bit of the codeword is precomputed from the encoder (the parity part of the
+ * generator rows) and the test patterns are walked in the Gray code order: from one test pattern to the next one,
+ * only one bit is flipped, so the syndrome is updated with a single XOR. The distance is only computed for the test
+ * patterns giving a codeword. The syndrome contributions are computed again when the encoder changes (frozen bits
+ * update of the polar codes).
+ */
+template <typename B = int, typename R = float>
+class Decoder_chase_fast : public Decoder_chase_std<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	const int             n_words;      // number of 64-bit words in a syndrome
+	std::vector<uint64_t> synd_contrib; // syndrome contribution of each bit of the codeword (N x 'n_words')
+	std::vector<uint64_t> synd;         // syndrome of the current test pattern
+
+public:
+	Decoder_chase_fast(const int K, const int N, Encoder<B> &encoder, const uint32_t max_flips = 3,
+	                   const bool hamming = false, const int n_frames = 1);
+	virtual ~Decoder_chase_fast() = default;
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+private:
+	void init_syndromes();
+
+	inline void flip_syndrome(const uint32_t n);
+	inline bool is_syndrome_null() const;
+};
+}
+}
+
+#endif /* DECODER_CHASE_FAST_HPP_ */
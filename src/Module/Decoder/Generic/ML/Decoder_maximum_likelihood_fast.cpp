@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <sstream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <bitset>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/common/hard_decide.h"
+#include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_maximum_likelihood_fast<B,R>
+::Decoder_maximum_likelihood_fast(const int K, const int N, Encoder<B> &encoder, const bool hamming,
+                                  const int n_threads, const int n_frames)
+: Decoder                        (K, N,          n_frames, 1),
+  Decoder_maximum_likelihood<B,R>(K, N, encoder, n_frames   ),
+  hamming(hamming),
+  n_threads(n_threads),
+  n_words((N + 63) / 64),
+  n_msgs(0),
+  rows(K * n_words, 0),
+  hard_w(n_words, 0),
+  lut(n_words * 8 * 256, 0.f)
+{
+	const std::string name = "Decoder_maximum_likelihood_fast";
+	this->set_name(name);
+
+	if (K >= 64)
+	{
+		std::stringstream message;
+		message << "'K' has to be smaller than 64 ('K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->n_msgs = (uint64_t)1 << (uint64_t)K;
+
+	this->init_rows();
+}
+
+template <typename B, typename R>
+int Decoder_maximum_likelihood_fast<B,R>
+::get_n_threads() const
+{
+	return this->n_threads;
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::notify_frozenbits_update()
+{
+	this->init_rows();
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::init_rows()
+{
+	std::fill(this->rows.begin(), this->rows.end(), (uint64_t)0);
+	std::fill(this->U_K .begin(), this->U_K .end(), (B)0);
+	for (auto k = 0; k < this->K; k++)
+	{
+		this->U_K[k] = (B)1;
+		this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+		this->U_K[k] = (B)0;
+
+		for (auto n = 0; n < this->N; n++)
+			if (this->X_N[n])
+				this->rows[k * this->n_words + n / 64] |= (uint64_t)1 << (n % 64);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::add_row(const int k, uint64_t *cw) const
+{
+	const auto row = this->rows.data() + k * this->n_words;
+	for (auto w = 0; w < this->n_words; w++)
+		cw[w] ^= row[w];
+}
+
+template <typename B, typename R>
+template <bool HAMMING>
+float Decoder_maximum_likelihood_fast<B,R>
+::compute_metric(const uint64_t *cw) const
+{
+	if (HAMMING)
+	{
+		uint32_t hamming_dist = 0;
+		for (auto w = 0; w < this->n_words; w++)
+			hamming_dist += (uint32_t)std::bitset<64>(cw[w] ^ this->hard_w[w]).count();
+		return (float)hamming_dist;
+	}
+	else
+	{
+		// minimizing the Euclidean distance is equivalent to minimizing the sum of the LLRs on the bits set to 1
+		auto metric = 0.f;
+		auto tab = this->lut.data();
+		for (auto w = 0; w < this->n_words; w++)
+			for (auto b = 0; b < 8; b++, tab += 256)
+				metric += tab[(cw[w] >> (8 * b)) & 0xFF];
+		return metric;
+	}
+}
+
+template <typename B, typename R>
+template <bool HAMMING>
+void Decoder_maximum_likelihood_fast<B,R>
+::search(const uint64_t first, const uint64_t last, float &best_metric, uint64_t &best_u) const
+{
+	std::vector<uint64_t> cw(this->n_words, 0);
+
+	// the message at the position 'i' in the Gray code order is 'i ^ (i >> 1)'
+	auto u = first ^ (first >> 1);
+	for (auto k = 0; k < this->K; k++)
+		if ((u >> k) & 1)
+			this->add_row(k, cw.data());
+
+	best_metric = this->template compute_metric<HAMMING>(cw.data());
+	best_u      = u;
+
+	for (auto i = first +1; i < last; i++)
+	{
+		// the information bit to flip is given by the position of the lowest bit set in 'i'
+		auto k = 0;
+		while (!((i >> k) & 1))
+			k++;
+
+		u ^= (uint64_t)1 << k;
+		this->add_row(k, cw.data());
+
+		// on equal metrics, keep the smallest message as the standard implementation
+		const auto metric = this->template compute_metric<HAMMING>(cw.data());
+		if (metric < best_metric || (metric == best_metric && u < best_u))
+		{
+			best_metric = metric;
+			best_u      = u;
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::decode(const bool hamming, B *V_N)
+{
+	// do not spawn more threads than useful for small message spaces
+	const auto n_thr = (int)std::min((uint64_t)this->n_threads, std::max((uint64_t)1, this->n_msgs >> 16));
+	const auto chunk = this->n_msgs / n_thr;
+
+	std::vector<float   > best_metric(n_thr);
+	std::vector<uint64_t> best_u     (n_thr);
+
+	auto worker = [&](const int t)
+	{
+		const auto first = t * chunk;
+		const auto last  = (t == n_thr -1) ? this->n_msgs : first + chunk;
+		if (hamming) this->template search<true >(first, last, best_metric[t], best_u[t]);
+		else         this->template search<false>(first, last, best_metric[t], best_u[t]);
+	};
+
+	// the calling thread is the thread 0
+	std::vector<std::thread> threads;
+	for (auto t = 1; t < n_thr; t++)
+		threads.push_back(std::thread(worker, t));
+	worker(0);
+	for (auto &t : threads)
+		t.join();
+
+	auto best = 0;
+	for (auto t = 1; t < n_thr; t++)
+		if (best_metric[t] < best_metric[best] || (best_metric[t] == best_metric[best] && best_u[t] < best_u[best]))
+			best = t;
+
+	// rebuild the best codeword from the generator rows
+	std::vector<uint64_t> cw(this->n_words, 0);
+	for (auto k = 0; k < this->K; k++)
+	{
+		this->best_U_K[k] = (B)((best_u[best] >> k) & 1);
+		if (this->best_U_K[k])
+			this->add_row(k, cw.data());
+	}
+
+	for (auto n = 0; n < this->N; n++)
+		V_N[n] = (B)((cw[n / 64] >> (n % 64)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_decode_siho_cw(Y_N, this->best_X_N.data(), frame_id);
+	std::copy(this->best_U_K.begin(), this->best_U_K.end(), V_K);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	// compute Hamming distance instead of Euclidean distance
+	if (hamming)
+	{
+		tools::hard_decide(Y_N, this->hard_Y_N.data(), this->N);
+		this->_decode_hiho_cw(this->hard_Y_N.data(), V_N, frame_id);
+	}
+	else
+	{
+		// build the table of the sums of the LLRs for the 256 values of each byte of the codeword
+		for (auto j = 0; j < this->n_words * 8; j++)
+		{
+			auto tab = this->lut.data() + j * 256;
+			tab[0] = 0.f;
+			for (auto v = 1; v < 256; v++)
+			{
+				auto b = 0;
+				while (!((v >> b) & 1))
+					b++;
+
+				const auto n = j * 8 + b;
+				tab[v] = tab[v & (v -1)] + (n < this->N ? (float)Y_N[n] : 0.f);
+			}
+		}
+
+		this->decode(false, V_N);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	this->_decode_hiho_cw(Y_N, this->best_X_N.data(), frame_id);
+	std::copy(this->best_U_K.begin(), this->best_U_K.end(), V_K);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	std::fill(this->hard_w.begin(), this->hard_w.end(), (uint64_t)0);
+	for (auto n = 0; n < this->N; n++)
+		if (Y_N[n])
+			this->hard_w[n / 64] |= (uint64_t)1 << (n % 64);
+
+	this->decode(true, V_N);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_8,Q_8>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_16,Q_16>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_32,Q_32>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
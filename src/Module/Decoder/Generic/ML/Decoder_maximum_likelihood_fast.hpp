@@ -0,0 +1,73 @@
+#ifndef DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_
+#define DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+#include "Module/Encoder/Encoder.hpp"
+#include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_maximum_likelihood_fast
+ *
+ * \brief Maximum likelihood decoder enumerating the codewords in the Gray code order (linear codes only).
+ *
+ * The generator rows are computed once from the encoder and stored bit-packed. From one message to the next one, only
+ * one information bit changes so the current codeword is updated with a single row XOR. The Euclidean distance is
+ * replaced by the equivalent sum of the LLRs on the bits set to 1, computed with one lookup per byte of the codeword
+ * in tables built for each frame, and the Hamming distance is computed with population counts. The message space
+ * is split in 'n_threads' contiguous ranges searched in parallel (the calling thread included). The generator rows
+ * are computed again when the encoder changes (frozen bits update of the polar codes).
+ */
+template <typename B = int, typename R = float>
+class Decoder_maximum_likelihood_fast : public Decoder_maximum_likelihood<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	const bool            hamming;
+	const int             n_threads; // number of threads used to search the message space
+	const int             n_words;   // number of 64-bit words in a packed codeword
+	uint64_t              n_msgs;    // number of messages to enumerate
+	std::vector<uint64_t> rows;      // bit-packed generator rows (K x 'n_words')
+	std::vector<uint64_t> hard_w;    // bit-packed hard decision of the current frame
+	std::vector<float   > lut;       // sum of the LLRs for each value of each byte of the codeword (8 'n_words' x 256)
+
+public:
+	Decoder_maximum_likelihood_fast(const int K, const int N, Encoder<B> &encoder, const bool hamming = false,
+	                                const int n_threads = 1, const int n_frames = 1);
+	virtual ~Decoder_maximum_likelihood_fast() = default;
+
+	int get_n_threads() const;
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	void _decode_siho   (const R *Y_N,  B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N, const int frame_id);
+	void _decode_hiho   (const B *Y_N,  B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N,  B *V_N, const int frame_id);
+
+	void decode(const bool hamming, B *V_N);
+
+	template <bool HAMMING>
+	void search(const uint64_t first, const uint64_t last, float &best_metric, uint64_t &best_u) const;
+
+private:
+	void init_rows();
+
+	inline void  add_row(const int k, uint64_t *cw) const;
+
+	template <bool HAMMING>
+	inline float compute_metric(const uint64_t *cw) const;
+};
+
+template <typename B = int, typename R = float>
+using Decoder_ML_fast = Decoder_maximum_likelihood_fast<B,R>;
+}
+}
+
+#endif /* DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_ */
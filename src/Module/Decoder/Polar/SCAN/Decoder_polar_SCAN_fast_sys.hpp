@@ -0,0 +1,94 @@
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_
+#define DECODER_POLAR_SCAN_FAST_SYS_
+
+#include <memory>
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+#include "Module/Decoder/Decoder_SISO_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCAN_fast_sys
+ *
+ * \brief Soft CANcellation (SCAN) decoder of the systematic polar codes working on the pruned decoding tree.
+ *
+ * The rate 0, rate 1, repetition and single parity check nodes are not expanded until the leaves: their backward
+ * soft messages (beta) are computed in closed form (min-sum approximation). The forward soft messages (lambda) are
+ * stored in a stack as in the fast SC decoder and the backward soft messages of each node are kept from one
+ * iteration to the next one.
+ */
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                               tools::g_LLR <B,R>,
+                                                               tools::g0_LLR<  R>,
+                                                               tools::h_LLR <B,R>,
+                                                               tools::xo_STD<B  >>>
+class Decoder_polar_SCAN_fast_sys : public Decoder_SISO_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	const int                m;            // graph depth
+	const int                max_iter;     // number of SCAN iterations
+	const  std::vector<bool> &frozen_bits; // frozen bits
+	      mipp::vector<R   > l;            // lambda, forward soft messages (stack)
+	      mipp::vector<R   > beta;         // backward soft messages of each node, (m+1) layers of N elements
+	      mipp::vector<R   > tmp;          // temporary soft messages
+
+	tools::Pattern_polar_parser polar_patterns;
+
+	bool is_init;
+
+public:
+	Decoder_polar_SCAN_fast_sys(const int& K, const int& N, const int& max_iter, const std::vector<bool>& frozen_bits,
+	                            const int n_frames = 1);
+
+	Decoder_polar_SCAN_fast_sys(const int& K, const int& N, const int& max_iter, const std::vector<bool>& frozen_bits,
+	                            std::vector<std::unique_ptr<tools::Pattern_polar_i>>&& polar_patterns,
+	                            const int idx_r0, const int idx_r1, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCAN_fast_sys() = default;
+
+	void reset();
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	void _load_init     (                                                       );
+	void _load          (const R *Y_N                                           );
+	void _decode        (                                                       );
+	void _decode_siho   (const R *Y_N,  B *V_K, const int frame_id              );
+	void _decode_siho_cw(const R *Y_N,  B *V_N, const int frame_id              );
+	void _decode_siso   (const R *sys, const R *par, R *ext, const int frame_id);
+	void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id             );
+	void _store         (               B *V_K                                  );
+	void _store_cw      (               B *V_N                                  );
+
+	void recursive_decode(const int off_l, const int off_s, const int reverse_depth, int &node_id);
+
+private:
+	void check_params();
+
+	inline R* be(const int reverse_depth, const int off_s);
+
+	inline void f (const R *l_a, const R *l_b, R *l_c, const int n_elmts);
+	inline void g0(const R *l_a, const R *l_b, R *l_c, const int n_elmts);
+
+	void rate_0(R *b_v,               const int n_elmts);
+	void rate_1(R *b_v,               const int n_elmts);
+	void rep   (R *b_v, const R *a_v, const int n_elmts);
+	void spc   (R *b_v, const R *a_v, const int n_elmts);
+};
+}
+}
+
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCAN_FAST_SYS_ */
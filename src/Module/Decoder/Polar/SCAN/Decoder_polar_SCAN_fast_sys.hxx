@@ -0,0 +1,477 @@
+#include <type_traits>
+#include <algorithm>
+#include <sstream>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::Decoder_polar_SCAN_fast_sys(const int& K, const int& N, const int& max_iter, const std::vector<bool>& frozen_bits,
+                              const int n_frames)
+: Decoder               (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                     ((int)std::log2(N)),
+  max_iter              (max_iter),
+  frozen_bits           (frozen_bits),
+  l                     (2 * N * this->simd_inter_frame_level + mipp::nElReg<R>()),
+  beta                  ((m +1) * N * this->simd_inter_frame_level + mipp::nElReg<R>()),
+  tmp                   (1 * N * this->simd_inter_frame_level + mipp::nElReg<R>()),
+  polar_patterns        (N,
+                         frozen_bits,
+                         {new tools::Pattern_polar_std,
+                          new tools::Pattern_polar_r0_left,
+                          new tools::Pattern_polar_r0,
+                          new tools::Pattern_polar_r1,
+                          new tools::Pattern_polar_rep_left,
+                          new tools::Pattern_polar_rep,
+                          new tools::Pattern_polar_spc},
+                         2,
+                         3),
+  is_init               (false)
+{
+	const std::string name = "Decoder_polar_SCAN_fast_sys";
+	this->set_name(name);
+
+	this->check_params();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::Decoder_polar_SCAN_fast_sys(const int& K, const int& N, const int& max_iter, const std::vector<bool>& frozen_bits,
+                              std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                              const int idx_r0, const int idx_r1, const int n_frames)
+: Decoder               (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                     ((int)std::log2(N)),
+  max_iter              (max_iter),
+  frozen_bits           (frozen_bits),
+  l                     (2 * N * this->simd_inter_frame_level + mipp::nElReg<R>()),
+  beta                  ((m +1) * N * this->simd_inter_frame_level + mipp::nElReg<R>()),
+  tmp                   (1 * N * this->simd_inter_frame_level + mipp::nElReg<R>()),
+  polar_patterns        (N, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1),
+  is_init               (false)
+{
+	const std::string name = "Decoder_polar_SCAN_fast_sys";
+	this->set_name(name);
+
+	this->check_params();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::check_params()
+{
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << this->N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << this->N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << this->K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (max_iter <= 0)
+	{
+		std::stringstream message;
+		message << "'max_iter' has to be greater than 0 ('max_iter' = " << max_iter << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::reset()
+{
+	this->is_init = false;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	polar_patterns.notify_frozenbits_update();
+	this->is_init = false;
+}
+
+template <typename B, typename R, class API_polar>
+R* Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::be(const int reverse_depth, const int off_s)
+{
+	return this->beta.data() + (reverse_depth * this->N + off_s) * API_polar::get_n_frames();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::f(const R *l_a, const R *l_b, R *l_c, const int n_elmts)
+{
+	// the SIMD routines can write a full register: the small nodes are processed sequentially to not overwrite the
+	// soft messages of the neighbour nodes
+	if (n_elmts * API_polar::get_n_frames() < mipp::nElReg<R>())
+		for (auto i = 0; i < n_elmts; i++)
+			l_c[i] = tools::f_LLR<R>(l_a[i], l_b[i]);
+	else
+		API_polar::f(l_a, l_b, l_c, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::g0(const R *l_a, const R *l_b, R *l_c, const int n_elmts)
+{
+	if (n_elmts * API_polar::get_n_frames() < mipp::nElReg<R>())
+		for (auto i = 0; i < n_elmts; i++)
+			l_c[i] = tools::g0_LLR<R>(l_a[i], l_b[i]);
+	else
+		API_polar::g0(l_a, l_b, l_c, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_load_init()
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// the leaves of the frozen bits are known, the other soft messages are unknown
+	std::fill(this->beta.begin(), this->beta.end(), tools::init_LLR<R>());
+	for (auto i = 0; i < this->N; i++)
+		if (frozen_bits[i])
+			std::fill(this->be(0, i), this->be(0, i) + n_frames, tools::sat_val<R>());
+
+	this->is_init = true;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_load(const R *Y_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	if (!this->is_init)
+		this->_load_init();
+
+	if (n_frames == 1)
+		std::copy(Y_N, Y_N + this->N, l.begin());
+	else
+	{
+		std::vector<const R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = Y_N + f*this->N;
+		tools::Reorderer_static<R,n_frames>::apply(frames, l.data(), this->N);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode()
+{
+	for (auto iter = 0; iter < max_iter; iter++)
+	{
+		int first_id = 0, off_l = 0, off_s = 0;
+		this->recursive_decode(off_l, off_s, m, first_id);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	if (!API_polar::isAligned(Y_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store(V_K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	if (!API_polar::isAligned(Y_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store_cw(V_N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// ----------------------------------------------------------------------------------------------------------- LOAD
+	this->_load_init();
+
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto sys_idx = f * this->K, par_idx = f * (this->N - this->K);
+		for (auto i = 0; i < this->N; i++)
+			l[i * n_frames + f] = frozen_bits[i] ? par[par_idx++] : sys[sys_idx++];
+	}
+
+	// --------------------------------------------------------------------------------------------------------- DECODE
+	this->_decode();
+
+	// ---------------------------------------------------------------------------------------------------------- STORE
+	const auto b_root = this->be(m, 0);
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto sys_idx = f * this->K;
+		for (auto i = 0; i < this->N; i++)
+			if (!frozen_bits[i]) // if "i" is NOT a frozen bit (information bit = sytematic bit)
+				ext[sys_idx++] = b_root[i * n_frames + f];
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// ----------------------------------------------------------------------------------------------------------- LOAD
+	this->_load(Y_N1);
+
+	// --------------------------------------------------------------------------------------------------------- DECODE
+	this->_decode();
+
+	// ---------------------------------------------------------------------------------------------------------- STORE
+	if (n_frames == 1)
+		std::copy(this->be(m, 0), this->be(m, 0) + this->N, Y_N2);
+	else
+	{
+		std::vector<R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = Y_N2 + f*this->N;
+		tools::Reorderer_static<R,n_frames>::apply_rev(this->be(m, 0), frames, this->N);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_store(B *V_K)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	const auto b_root = this->be(m, 0);
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto k = f * this->K;
+		for (auto i = 0; i < this->N; i++)
+			if (!frozen_bits[i]) // if i is not a frozen bit
+				V_K[k++] = tools::h_LLR<B,R>(b_root[i * n_frames + f] + l[i * n_frames + f]);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_store_cw(B *V_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	const auto b_root = this->be(m, 0);
+	for (auto f = 0; f < n_frames; f++)
+		for (auto i = 0; i < this->N; i++)
+			V_N[f * this->N + i] = tools::h_LLR<B,R>(b_root[i * n_frames + f] + l[i * n_frames + f]);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::recursive_decode(const int off_l, const int off_s, const int reverse_depth, int &node_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	const int n_elmts = 1 << reverse_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	const R *a_u = this->l.data() + (off_l              ) * n_frames; // lambda of the node (upper half)
+	const R *a_d = this->l.data() + (off_l + n_elm_2    ) * n_frames; // lambda of the node (lower half)
+	      R *a_c = this->l.data() + (off_l + n_elmts    ) * n_frames; // lambda of the children
+	      R *b_v = this->be(reverse_depth, off_s);                     // beta of the node
+	      R *t_v = this->tmp.data() + off_s * n_frames;
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		const R *b_l = this->be(reverse_depth -1, off_s          ); // beta of the left child
+		const R *b_r = this->be(reverse_depth -1, off_s + n_elm_2); // beta of the right child
+
+		if (node_type == tools::polar_node_t::RATE_0_LEFT)
+		{
+			this->recursive_decode(off_l + n_elmts, off_s, reverse_depth -1, ++node_id); // recursive call left
+
+			// the beta of the left child is saturated: the f functions reduce to g0 functions
+			g0(a_u, a_d, a_c, n_elm_2);
+
+			this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // recursive call right
+
+			g0(b_r, a_d, b_v,                      n_elm_2);
+			g0(b_r, a_u, b_v + n_elm_2 * n_frames, n_elm_2);
+		}
+		else
+		{
+			// f (the beta of the right child comes from the previous iteration)
+			g0(a_d, b_r, t_v, n_elm_2);
+			f (a_u, t_v, a_c, n_elm_2);
+
+			this->recursive_decode(off_l + n_elmts, off_s, reverse_depth -1, ++node_id); // recursive call left
+
+			// g
+			f (a_u, b_l, t_v, n_elm_2);
+			g0(a_d, t_v, a_c, n_elm_2);
+
+			this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // recursive call right
+
+			// beta of the node
+			g0(b_r, a_d, a_c,                      n_elm_2);
+			f (b_l, a_c, b_v,                      n_elm_2);
+			g0(b_r, t_v, b_v + n_elm_2 * n_frames, n_elm_2);
+		}
+	}
+	else
+	{
+		const R *a_v = a_u;
+		switch (node_type)
+		{
+			case tools::polar_node_t::RATE_0: this->rate_0(b_v,      n_elmts); break;
+			case tools::polar_node_t::RATE_1: this->rate_1(b_v,      n_elmts); break;
+			case tools::polar_node_t::REP:    this->rep   (b_v, a_v, n_elmts); break;
+			case tools::polar_node_t::SPC:    this->spc   (b_v, a_v, n_elmts); break;
+			default:
+				break;
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::rate_0(R *b_v, const int n_elmts)
+{
+	std::fill(b_v, b_v + n_elmts * API_polar::get_n_frames(), tools::sat_val<R>());
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::rate_1(R *b_v, const int n_elmts)
+{
+	std::fill(b_v, b_v + n_elmts * API_polar::get_n_frames(), tools::init_LLR<R>());
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::rep(R *b_v, const R *a_v, const int n_elmts)
+{
+	// accumulate in 32-bit for the fixed-point representations
+	using A = typename std::conditional<std::is_integral<R>::value, int32_t, R>::type;
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// beta_i = sum_{j != i} lambda_j
+	for (auto f = 0; f < n_frames; f++)
+	{
+		A sum = 0;
+		for (auto i = 0; i < n_elmts; i++)
+			sum += (A)a_v[i * n_frames + f];
+
+		for (auto i = 0; i < n_elmts; i++)
+			b_v[i * n_frames + f] = (R)tools::saturate<A>(sum - (A)a_v[i * n_frames + f],
+			                                              -(A)tools::sat_val<R>(),
+			                                               (A)tools::sat_val<R>());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::spc(R *b_v, const R *a_v, const int n_elmts)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// beta_i = prod_{j != i} sign(lambda_j) * min_{j != i} |lambda_j|
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto sign = false;
+		auto min1 = tools::sat_val<R>(), min2 = tools::sat_val<R>();
+		auto pos  = 0;
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			const auto a = a_v[i * n_frames + f];
+			const auto abs_a = (a >= 0) ? a : (R)-a;
+			sign ^= (a < 0);
+			if (abs_a < min1)
+			{
+				min2 = min1;
+				min1 = abs_a;
+				pos  = i;
+			}
+			else if (abs_a < min2)
+				min2 = abs_a;
+		}
+
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			const auto mag = (i == pos) ? min2 : min1;
+			b_v[i * n_frames + f] = (sign ^ (a_v[i * n_frames + f] < 0)) ? (R)-mag : mag;
+		}
+	}
+}
+}
+}
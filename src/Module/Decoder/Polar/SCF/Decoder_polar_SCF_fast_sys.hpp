@@ -0,0 +1,85 @@
+#ifndef DECODER_POLAR_SCF_FAST_SYS_
+#define DECODER_POLAR_SCF_FAST_SYS_
+
+#include <memory>
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Module/CRC/CRC.hpp"
+#include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar, int REV_D>
+struct Decoder_polar_SCF_fast_sys_static;
+
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                               tools::g_LLR <B,R>,
+                                                               tools::g0_LLR<  R>,
+                                                               tools::h_LLR <B,R>,
+                                                               tools::xo_STD<B  >>>
+class Decoder_polar_SCF_fast_sys : public Decoder_polar_SC_fast_sys<B,R,API_polar>
+{
+	template <typename, typename, class, int> friend struct Decoder_polar_SCF_fast_sys_static;
+
+protected:
+	struct Flip_candidate
+	{
+		int   node_id; // id of the terminal node which decided the bit(s)
+		int   pos;     // position of the first bit to flip in the partial sums
+		int   n_bits;  // number of consecutive bits to flip (the whole node for a repetition node)
+		int   pos_bis; // position of the bit flipped to keep the parity of a SPC node (-1 otherwise)
+		float metric;  // the lower the metric, the more likely the bit(s) are wrong
+	};
+
+	CRC<B>& crc;
+
+	const int   n_flips;
+	const float alpha;      // dynamic SCF metric parameter (0 = original SCF metric)
+
+	std::vector<int           > node_end;   // id of the first node after the sub-tree of a node
+	std::vector<Flip_candidate> candidates; // candidates found during the reference decoding
+	std::vector<int           > flip_order; // candidates sorted by increasing metric
+	mipp::vector<B            > s_ref;      // partial sums of the reference decoding
+	mipp::vector<B            > U_K;        // information bits for the CRC check
+	int                         flip_node;  // node of the current flip attempt (-1 for the reference decoding)
+	int                         flip_cand;  // candidate of the current flip attempt
+
+public:
+	Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+	                           CRC<B>& crc, const int n_flips, const float alpha = 0.f, const int n_frames = 1);
+
+	Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+	                           std::vector<std::unique_ptr<tools::Pattern_polar_i>>&& polar_patterns,
+	                           const int idx_r0, const int idx_r1,
+	                           CRC<B>& crc, const int n_flips, const float alpha = 0.f, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCF_fast_sys() = default;
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	void _decode();
+
+	void init_node_end       (const int reverse_depth, int &node_id);
+	void recursive_decode_scf(const int off_l, const int off_s, const int reverse_depth, int &node_id);
+	void add_candidates      (const tools::polar_node_t node_type, const int off_l, const int off_s,
+	                          const int n_elmts, const int node_id);
+	void flip                (                                                             );
+	bool check_crc           (                                                             );
+
+private:
+	void check_params();
+};
+}
+}
+
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCF_FAST_SYS_ */
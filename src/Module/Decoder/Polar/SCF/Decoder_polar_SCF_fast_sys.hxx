@@ -0,0 +1,455 @@
+#include <cmath>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Math/utils.h"
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Polar/fb_extract.h"
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar, int REV_D>
+struct Decoder_polar_SCF_fast_sys_static
+{
+	static void decode(Decoder_polar_SCF_fast_sys<B,R,API_polar> &dec, const int off_l, const int off_s, int &node_id)
+	{
+		constexpr int reverse_depth = REV_D;
+		constexpr int n_elmts = 1 << reverse_depth;
+		constexpr int n_elm_2 = n_elmts >> 1;
+
+		auto &l = dec.l;
+		auto &s = dec.s;
+
+		const auto first_id = node_id;
+		const tools::polar_node_t node_type = dec.polar_patterns.get_node_type(node_id);
+
+		const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+		                                 (node_type == tools::polar_node_t::RATE_1) ||
+		                                 (node_type == tools::polar_node_t::REP)    ||
+		                                 (node_type == tools::polar_node_t::SPC);
+
+		if (!is_terminal_pattern && reverse_depth)
+		{
+			// f
+			switch (node_type)
+			{
+				case tools::polar_node_t::STANDARD: API_polar::template f<n_elm_2>(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+				case tools::polar_node_t::REP_LEFT: API_polar::template f<n_elm_2>(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+				default:
+					break;
+			}
+
+			Decoder_polar_SCF_fast_sys_static<B,R,API_polar,REV_D-1>
+			::decode(dec, off_l + n_elmts, off_s, ++node_id); // recursive call left
+
+			// g
+			switch (node_type)
+			{
+				case tools::polar_node_t::STANDARD:    API_polar::template g <n_elm_2>(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+				case tools::polar_node_t::RATE_0_LEFT: API_polar::template g0<n_elm_2>(   l, off_l, off_l + n_elm_2,        off_l + n_elmts, n_elm_2); break;
+				case tools::polar_node_t::REP_LEFT:    API_polar::template gr<n_elm_2>(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+				default:
+					break;
+			}
+
+			Decoder_polar_SCF_fast_sys_static<B,R,API_polar,REV_D-1>
+			::decode(dec, off_l + n_elmts, off_s + n_elm_2, ++node_id); // recursive call right
+
+			// xor
+			switch (node_type)
+			{
+				case tools::polar_node_t::STANDARD:    API_polar::template xo <n_elm_2>(s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+				case tools::polar_node_t::RATE_0_LEFT: API_polar::template xo0<n_elm_2>(s,        off_s + n_elm_2, off_s, n_elm_2); break;
+				case tools::polar_node_t::REP_LEFT:    API_polar::template xo <n_elm_2>(s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+				default:
+					break;
+			}
+		}
+		else
+		{
+			// h
+			switch (node_type)
+			{
+				case tools::polar_node_t::RATE_0: API_polar::template h0 <n_elmts>(s,           off_s, n_elmts); break;
+				case tools::polar_node_t::RATE_1: API_polar::template h  <n_elmts>(s, l, off_l, off_s, n_elmts); break;
+				case tools::polar_node_t::REP:    API_polar::template rep<n_elmts>(s, l, off_l, off_s, n_elmts); break;
+				case tools::polar_node_t::SPC:    API_polar::template spc<n_elmts>(s, l, off_l, off_s, n_elmts); break;
+				default:
+					break;
+			}
+
+			dec.add_candidates(node_type, off_l, off_s, n_elmts, first_id);
+		}
+	}
+};
+
+template <typename B, typename R, class API_polar>
+struct Decoder_polar_SCF_fast_sys_static<B,R,API_polar,0>
+{
+	static void decode(Decoder_polar_SCF_fast_sys<B,R,API_polar> &dec, const int off_l, const int off_s, int &node_id)
+	{
+		constexpr int reverse_depth = 0;
+		constexpr int n_elmts = 1 << reverse_depth;
+
+		const tools::polar_node_t node_t = dec.polar_patterns.get_node_type(node_id);
+
+		switch (node_t)
+		{
+			case tools::polar_node_t::RATE_0: API_polar::template h0<n_elmts>(dec.s,               off_s, n_elmts); break;
+			case tools::polar_node_t::RATE_1: API_polar::template h <n_elmts>(dec.s, dec.l, off_l, off_s, n_elmts); break;
+			default:
+				break;
+		}
+
+		dec.add_candidates(node_t, off_l, off_s, n_elmts, node_id);
+	}
+};
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+                             CRC<B>& crc, const int n_flips, const float alpha, const int n_frames)
+: Decoder                                (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SC_fast_sys<B,R,API_polar>(K, N, frozen_bits, n_frames),
+  crc                                    (crc),
+  n_flips                                (n_flips),
+  alpha                                  (alpha),
+  node_end                               (2 * N, 0),
+  s_ref                                  (N),
+  U_K                                    (K),
+  flip_node                              (-1),
+  flip_cand                              (-1)
+{
+	const std::string name = "Decoder_polar_SCF_fast_sys";
+	this->set_name(name);
+
+	this->check_params();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+                             std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                             const int idx_r0, const int idx_r1,
+                             CRC<B>& crc, const int n_flips, const float alpha, const int n_frames)
+: Decoder                                (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SC_fast_sys<B,R,API_polar>(K, N, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, n_frames),
+  crc                                    (crc),
+  n_flips                                (n_flips),
+  alpha                                  (alpha),
+  node_end                               (2 * N, 0),
+  s_ref                                  (N),
+  U_K                                    (K),
+  flip_node                              (-1),
+  flip_cand                              (-1)
+{
+	const std::string name = "Decoder_polar_SCF_fast_sys";
+	this->set_name(name);
+
+	this->check_params();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::check_params()
+{
+	if (API_polar::get_n_frames() != 1)
+	{
+		std::stringstream message;
+		message << "The inter-frame SIMD strategy is not supported ('API_polar::get_n_frames()' = "
+		        << API_polar::get_n_frames() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (crc.get_size() > this->K)
+	{
+		std::stringstream message;
+		message << "'crc.get_size()' has to be equal or smaller than 'K' ('crc.get_size()' = " << crc.get_size()
+		        << ", 'K' = " << this->K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_flips < 0)
+	{
+		std::stringstream message;
+		message << "'n_flips' has to be positive ('n_flips' = " << n_flips << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (alpha < 0.f)
+	{
+		std::stringstream message;
+		message << "'alpha' has to be positive ('alpha' = " << alpha << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	candidates.reserve(this->N);
+	flip_order.reserve(this->N);
+
+	int first_id = 0;
+	this->init_node_end(this->m, first_id);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	Decoder_polar_SC_fast_sys<B,R,API_polar>::notify_frozenbits_update();
+
+	int first_id = 0;
+	this->init_node_end(this->m, first_id);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::init_node_end(const int reverse_depth, int &node_id)
+{
+	const auto first_id  = node_id;
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		this->init_node_end(reverse_depth -1, ++node_id);
+		this->init_node_end(reverse_depth -1, ++node_id);
+	}
+
+	node_end[first_id] = node_id +1;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::_decode()
+{
+	// reference decoding (standard SC), the flip candidates are collected on the fly
+	candidates.clear();
+	flip_node = -1;
+	int first_id = 0;
+	this->recursive_decode_scf(0, 0, this->m, first_id);
+
+	if (this->check_crc() || n_flips == 0 || candidates.empty())
+		return;
+
+	std::copy(this->s.begin(), this->s.begin() + this->N, s_ref.begin());
+
+	// dynamic SCF metric: penalize the candidates decided after reliable bits
+	if (alpha > 0.f)
+	{
+		auto penalty = 0.f;
+		for (auto &c : candidates)
+		{
+			penalty  += std::log1p(std::exp(-alpha * c.metric)) / alpha;
+			c.metric += penalty;
+		}
+	}
+
+	const auto n_attempts = std::min(n_flips, (int)candidates.size());
+	flip_order.resize(candidates.size());
+	for (auto c = 0; c < (int)candidates.size(); c++)
+		flip_order[c] = c;
+	std::partial_sort(flip_order.begin(), flip_order.begin() + n_attempts, flip_order.end(),
+	                  [this](const int& a, const int& b)
+	                  {return this->candidates[a].metric < this->candidates[b].metric;});
+
+	auto decode_result = false;
+	for (auto a = 0; a < n_attempts && !decode_result; a++)
+	{
+		// the bits decided before the flipped node are the ones of the reference decoding: only the suffix of the
+		// tree is decoded again
+		std::copy(s_ref.begin(), s_ref.end(), this->s.begin());
+		flip_cand = flip_order[a];
+		flip_node = candidates[flip_cand].node_id;
+
+		first_id = 0;
+		this->recursive_decode_scf(0, 0, this->m, first_id);
+
+		decode_result = this->check_crc();
+	}
+
+	// keep the reference decoding when all the flip attempts failed
+	if (!decode_result)
+		std::copy(s_ref.begin(), s_ref.end(), this->s.begin());
+
+	flip_node = -1;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::recursive_decode_scf(const int off_l, const int off_s, const int reverse_depth, int &node_id)
+{
+	const auto first_id = node_id;
+
+	if (flip_node >= 0 && node_end[first_id] <= flip_node)
+	{
+		// sub-tree decoded before the flipped node: its partial sums are already in 's'
+		node_id = node_end[first_id] -1;
+		return;
+	}
+
+	if (flip_node >= 0 && first_id > flip_node)
+	{
+		// sub-tree decoded after the flipped node: standard fast SC decoding
+		this->recursive_decode(off_l, off_s, reverse_depth, node_id);
+		return;
+	}
+
+	if (flip_node < 0 && reverse_depth == static_level)
+	{
+		Decoder_polar_SCF_fast_sys_static<B,R,API_polar,static_level>::decode(*this, off_l, off_s, node_id);
+		return;
+	}
+
+	auto &l = this->l;
+	auto &s = this->s;
+
+	const int n_elmts = 1 << reverse_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		// the node contains the flipped node: 's' holds the partial sums of the reference decoding for this node,
+		// undo the xor to retrieve the partial sums of the left sub-tree
+		if (flip_node >= 0)
+			API_polar::xo(s, off_s, off_s + n_elm_2, off_s, n_elm_2);
+
+		const bool go_left = flip_node < 0 || flip_node < node_end[first_id +1];
+
+		// f
+		if (go_left)
+			switch (node_type)
+			{
+				case tools::polar_node_t::STANDARD: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+				case tools::polar_node_t::REP_LEFT: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+				default:
+					break;
+			}
+
+		this->recursive_decode_scf(off_l + n_elmts, off_s, reverse_depth -1, ++node_id); // recursive call left
+
+		// g
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::g (s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::g0(   l, off_l, off_l + n_elm_2,        off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::gr(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+			default:
+				break;
+		}
+
+		this->recursive_decode_scf(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // recursive call right
+
+		// xor
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::xo0(s,        off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			default:
+				break;
+		}
+	}
+	else
+	{
+		// h
+		switch (node_type)
+		{
+			case tools::polar_node_t::RATE_0: API_polar::h0 (s,           off_s, n_elmts); break;
+			case tools::polar_node_t::RATE_1: API_polar::h  (s, l, off_l, off_s, n_elmts); break;
+			case tools::polar_node_t::REP:    API_polar::rep(s, l, off_l, off_s, n_elmts); break;
+			case tools::polar_node_t::SPC:    API_polar::spc(s, l, off_l, off_s, n_elmts); break;
+			default:
+				break;
+		}
+
+		if (flip_node < 0)
+			this->add_candidates(node_type, off_l, off_s, n_elmts, first_id);
+		else
+			this->flip();
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::add_candidates(const tools::polar_node_t node_type, const int off_l, const int off_s, const int n_elmts,
+                 const int node_id)
+{
+	const auto *l = this->l.data() + off_l;
+
+	switch (node_type)
+	{
+		case tools::polar_node_t::RATE_1:
+		{
+			for (auto i = 0; i < n_elmts; i++)
+				candidates.push_back({node_id, off_s + i, 1, -1, std::abs((float)l[i])});
+			break;
+		}
+		case tools::polar_node_t::REP:
+		{
+			auto sum = 0.f;
+			for (auto i = 0; i < n_elmts; i++)
+				sum += (float)l[i];
+			candidates.push_back({node_id, off_s, n_elmts, -1, std::abs(sum)});
+			break;
+		}
+		case tools::polar_node_t::SPC:
+		{
+			// flip a bit and the least reliable one to keep the parity of the node
+			auto min_pos = 0;
+			auto parity  = 0;
+			for (auto i = 0; i < n_elmts; i++)
+			{
+				if (std::abs((float)l[i]) < std::abs((float)l[min_pos]))
+					min_pos = i;
+				parity ^= (l[i] < 0) ? 1 : 0;
+			}
+
+			// the least reliable bit has been corrected by the SPC decoding when the parity was not verified
+			const auto min_abs = std::abs((float)l[min_pos]);
+			const auto min_met = parity ? -min_abs : min_abs;
+
+			for (auto i = 0; i < n_elmts; i++)
+				if (i != min_pos)
+					candidates.push_back({node_id, off_s + i, 1, off_s + min_pos, std::abs((float)l[i]) + min_met});
+			break;
+		}
+		default:
+			break;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::flip()
+{
+	const auto &c = candidates[flip_cand];
+
+	for (auto i = c.pos; i < c.pos + c.n_bits; i++)
+		this->s[i] = this->s[i] ? (B)0 : tools::bit_init<B>();
+
+	if (c.pos_bis >= 0)
+		this->s[c.pos_bis] = this->s[c.pos_bis] ? (B)0 : tools::bit_init<B>();
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::check_crc()
+{
+	tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s.data(), U_K.data());
+	return crc.check(U_K, this->get_simd_inter_frame_level());
+}
+}
+}
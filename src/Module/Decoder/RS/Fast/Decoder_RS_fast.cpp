@@ -0,0 +1,314 @@
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "Tools/Perf/common/hard_decide.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
+#include "Module/Decoder/RS/Fast/Decoder_RS_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_RS_fast<B,R>
+::Decoder_RS_fast(const int& K, const int& N, const tools::RS_polynomial_generator &GF, const int n_frames)
+: Decoder        (K * GF.get_m(), N * GF.get_m(), n_frames, mipp::N<B>()),
+  Decoder_RS<B,R>(K, N, GF, n_frames                                    ),
+  t2             (2 * this->t                                           ),
+  YH_N_fast      (this->N_rs * mipp::N<B>()                             ),
+  YH_Nb_fast     (this->N    * mipp::N<B>()                             ),
+  Y_N_reorderered(this->N_rs, mipp::Reg<S>((S)0)                        ),
+  s              (t2 +1,      mipp::Reg<S>((S)0)                        ),
+  reg            (this->t +1, mipp::Reg<S>((S)0)                        ),
+  s_lanes        ((t2 +1) * mipp::N<B>()                                ),
+  elp_lanes      ((this->t +1) * mipp::N<B>()                           ),
+  l_lanes        (mipp::N<B>()                                          ),
+  loc_lanes      (this->t * mipp::N<B>()                                ),
+  n_roots        (mipp::N<B>()                                          ),
+  elp            (t2 +1                                                 ),
+  elp_prev       (t2 +1                                                 ),
+  elp_tmp        (t2 +1                                                 ),
+  omega          (t2 +1                                                 ),
+  mul_a_i        (t2 +1                                                 ),
+  mul_a_i0       (this->t +1                                            )
+{
+	const std::string name = "Decoder_RS_fast";
+	this->set_name(name);
+
+	if (this->m > (int)sizeof(S) * 8)
+	{
+		std::stringstream message;
+		message << "'m' has to be smaller or equal to the number of bits of a symbol ('m' = " << this->m
+		        << ", 'sizeof(S) * 8' = " << sizeof(S) * 8 << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto i = 1; i <= t2; i++)
+		this->mul_a_i[i] = tools::Galois_linear_map<S>::mul(this->alpha_to, i);
+
+	const auto i0 = this->N_p2_1 - this->N_rs;
+	for (auto j = 1; j <= this->t; j++)
+		this->mul_a_i0[j] = tools::Galois_linear_map<S>::mul(this->alpha_to, (j * i0) % this->N_p2_1);
+}
+
+template <typename B, typename R>
+bool Decoder_RS_fast<B,R>
+::berlekamp_massey(const int f)
+{
+	constexpr auto n_lanes = mipp::N<B>();
+	const auto synd = [&](const int i) { return (int)this->s_lanes[i * n_lanes + f] & this->N_p2_1; };
+
+	std::fill(this->elp     .begin(), this->elp     .end(), 0);
+	std::fill(this->elp_prev.begin(), this->elp_prev.end(), 0);
+	this->elp     [0] = 1;
+	this->elp_prev[0] = 1;
+
+	auto l = 0, shift = 1, prev_disc = 1;
+	for (auto n = 0; n < t2; n++)
+	{
+		// compute the discrepancy
+		auto disc = synd(n +1);
+		for (auto i = 1; i <= l; i++)
+			disc ^= tools::gf_mul(this->elp[i], synd(n +1 -i), this->alpha_to, this->index_of);
+
+		if (disc == 0)
+		{
+			shift++;
+			continue;
+		}
+
+		const auto coef = tools::gf_div(disc, prev_disc, this->alpha_to, this->index_of);
+		if (2 * l <= n)
+		{
+			this->elp_tmp = this->elp;
+			for (auto i = 0; i + shift <= t2; i++)
+				this->elp[i + shift] ^= tools::gf_mul(coef, this->elp_prev[i], this->alpha_to, this->index_of);
+
+			l               = n +1 - l;
+			this->elp_prev  = this->elp_tmp;
+			prev_disc       = disc;
+			shift           = 1;
+		}
+		else
+		{
+			for (auto i = 0; i + shift <= t2; i++)
+				this->elp[i + shift] ^= tools::gf_mul(coef, this->elp_prev[i], this->alpha_to, this->index_of);
+			shift++;
+		}
+	}
+
+	if (l > this->t) // elp has degree > t hence cannot solve
+		return false;
+
+	this->l_lanes[f] = l;
+	for (auto i = 0; i <= l; i++)
+		this->elp_lanes[i * n_lanes + f] = (S)this->elp[i];
+
+	return true;
+}
+
+template <typename B, typename R>
+bool Decoder_RS_fast<B,R>
+::forney(const int f, S *Y_N)
+{
+	constexpr auto n_lanes = mipp::N<B>();
+	const auto synd = [&](const int i) { return (int)this->s_lanes  [i * n_lanes + f] & this->N_p2_1; };
+	const auto lamb = [&](const int i) { return (int)this->elp_lanes[i * n_lanes + f] & this->N_p2_1; };
+	const auto l    = this->l_lanes[f];
+
+	// error evaluator polynomial: omega(x) = S(x) * elp(x) mod x^l
+	for (auto k = 0; k < l; k++)
+	{
+		this->omega[k] = 0;
+		for (auto i = 0; i <= k; i++)
+			this->omega[k] ^= tools::gf_mul(lamb(i), synd(k - i +1), this->alpha_to, this->index_of);
+	}
+
+	// error values: omega(X^-1) / elp'(X^-1)
+	for (auto r = 0; r < l; r++)
+	{
+		const auto x_inv = (this->N_p2_1 - this->loc_lanes[r * n_lanes + f]) % this->N_p2_1; // index form
+
+		auto num = 0;
+		for (auto k = 0; k < l; k++)
+			if (this->omega[k])
+				num ^= this->alpha_to[(this->index_of[this->omega[k]] + k * x_inv) % this->N_p2_1];
+
+		auto den = 0;
+		for (auto i = 1; i <= l; i += 2)
+			if (lamb(i))
+				den ^= this->alpha_to[(this->index_of[lamb(i)] + (i -1) * x_inv) % this->N_p2_1];
+
+		if (!den)
+			return false;
+
+		this->elp_tmp[r] = tools::gf_div(num, den, this->alpha_to, this->index_of);
+	}
+
+	for (auto r = 0; r < l; r++)
+	{
+		const auto loc = this->loc_lanes[r * n_lanes + f];
+		Y_N[loc] = (S)(((int)Y_N[loc] & this->N_p2_1) ^ this->elp_tmp[r]);
+	}
+
+	return true;
+}
+
+template <typename B, typename R>
+void Decoder_RS_fast<B,R>
+::_decode(S *Y_N, const int frame_id)
+{
+	constexpr auto n_lanes = mipp::N<B>();
+	const auto r_zero = mipp::Reg<S>((S)0);
+	const auto r_one  = mipp::Reg<S>((S)1);
+
+	// reorder the symbols into mipp registers
+	std::vector<const S*> frames(n_lanes);
+	for (auto f = 0; f < n_lanes; f++)
+		frames[f] = Y_N + f * this->N_rs;
+	tools::Reorderer_static<S,mipp::N<B>()>::apply(frames, (S*)this->Y_N_reorderered.data(), this->N_rs);
+
+	// form the syndromes with the Horner scheme
+	const auto syn_error = tools::gf_syndromes(this->Y_N_reorderered.data(), this->N_rs, this->mul_a_i, t2,
+	                                           this->s.data());
+
+	if (mipp::testz(syn_error)) // no non-zero syndromes => no errors: output received codewords
+	{
+		this->last_is_codeword = true;
+		return;
+	}
+
+	S err_lanes[mipp::N<B>()];
+	mipp::toReg<S>(syn_error).store(err_lanes);
+
+	for (auto i = 1; i <= t2; i++)
+		this->s[i].store(this->s_lanes.data() + i * n_lanes);
+
+	// compute the error location polynomial of the frames with errors
+	std::fill(this->elp_lanes.begin(), this->elp_lanes.end(), (S)0);
+	std::fill(this->l_lanes  .begin(), this->l_lanes  .end(), -1    );
+	std::fill(this->n_roots  .begin(), this->n_roots  .end(),  0    );
+
+	auto l_max = 0;
+	for (auto f = 0; f < n_lanes; f++)
+		if (err_lanes[f] && this->berlekamp_massey(f))
+			l_max = std::max(l_max, this->l_lanes[f]);
+
+	// Chien search: find roots of the error location polynomials, only on the positions of the (shortened) codewords
+	if (l_max > 0)
+	{
+		const auto i0 = this->N_p2_1 - this->N_rs;
+		for (auto j = 1; j <= l_max; j++)
+		{
+			S coefs[mipp::N<B>()];
+			for (auto f = 0; f < n_lanes; f++)
+				coefs[f] = this->elp_lanes[j * n_lanes + f];
+			this->reg[j] = this->mul_a_i0[j].apply(mipp::Reg<S>(coefs));
+		}
+
+		for (auto i = i0 +1; i <= this->N_p2_1; i++)
+		{
+			auto r_q = r_one;
+			for (auto j = 1; j <= l_max; j++)
+			{
+				this->reg[j] = this->mul_a_i[j].apply(this->reg[j]);
+				r_q ^= this->reg[j];
+			}
+
+			const auto m_root = r_q == r_zero;
+			if (!mipp::testz(m_root))
+			{
+				S root_lanes[mipp::N<B>()];
+				mipp::toReg<S>(m_root).store(root_lanes);
+
+				for (auto f = 0; f < n_lanes; f++)
+					if (root_lanes[f])
+					{
+						// store error location number indices
+						if (this->n_roots[f] < this->t)
+							this->loc_lanes[this->n_roots[f] * n_lanes + f] = this->N_p2_1 - i;
+						this->n_roots[f]++;
+					}
+			}
+		}
+	}
+
+	// correct the errors of the frames for which the number of roots is equal to the degree of elp
+	this->last_is_codeword = true;
+	for (auto f = 0; f < n_lanes; f++)
+		if (err_lanes[f])
+			this->last_is_codeword &= this->l_lanes[f] > 0 && this->n_roots[f] == this->l_lanes[f] &&
+			                          this->forney(f, Y_N + f * this->N_rs);
+}
+
+template <typename B, typename R>
+void Decoder_RS_fast<B,R>
+::_load(const B *Y_N)
+{
+	for (auto f = 0; f < mipp::N<B>(); f++)
+		tools::Bit_packer::pack(Y_N + f * this->N, this->YH_N_fast.data() + f * this->N_rs, this->N, 1, false,
+		                        this->m);
+}
+
+template <typename B, typename R>
+void Decoder_RS_fast<B,R>
+::_store(B *V, const bool cw)
+{
+	for (auto f = 0; f < mipp::N<B>(); f++)
+		if (cw)
+			tools::Bit_packer::unpack(this->YH_N_fast.data() + f * this->N_rs, V + f * this->N, this->N, 1, false,
+			                          this->m);
+		else
+			tools::Bit_packer::unpack(this->YH_N_fast.data() + f * this->N_rs + this->n_rdncy, V + f * this->K,
+			                          this->K, 1, false, this->m);
+}
+
+template <typename B, typename R>
+void Decoder_RS_fast<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode(this->YH_N_fast.data(), frame_id);
+	this->_store(V_K, false);
+}
+
+template <typename B, typename R>
+void Decoder_RS_fast<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode(this->YH_N_fast.data(), frame_id);
+	this->_store(V_N, true);
+}
+
+template <typename B, typename R>
+void Decoder_RS_fast<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	tools::hard_decide(Y_N, this->YH_Nb_fast.data(), this->N * mipp::N<B>());
+
+	this->_decode_hiho(this->YH_Nb_fast.data(), V_K, frame_id);
+}
+
+template <typename B, typename R>
+void Decoder_RS_fast<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	tools::hard_decide(Y_N, this->YH_Nb_fast.data(), this->N * mipp::N<B>());
+
+	this->_decode_hiho_cw(this->YH_Nb_fast.data(), V_N, frame_id);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_RS_fast<B_8,Q_8>;
+template class aff3ct::module::Decoder_RS_fast<B_16,Q_16>;
+template class aff3ct::module::Decoder_RS_fast<B_32,Q_32>;
+template class aff3ct::module::Decoder_RS_fast<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_RS_fast<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,73 @@
+#ifndef DECODER_RS_FAST
+#define DECODER_RS_FAST
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/RS/RS_polynomial_generator.hpp"
+#include "Tools/Math/Galois_kernels.hpp"
+#include "Module/Decoder/RS/Decoder_RS.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RS_fast
+ *
+ * \brief Reed-Solomon decoder processing mipp::N<B>() frames at once (one frame per SIMD lane).
+ *
+ * The syndromes (Horner scheme) and the Chien search are computed in the SIMD registers: the multiplications by the
+ * constant powers of alpha are bit-sliced (see tools::Galois_linear_map), so no table lookup is required.
+ * The Berlekamp-Massey algorithm and the Forney algorithm are only run on the frames with a non-null syndrome.
+ * 'last_is_codeword' is true if all the frames of the last decoded group are codewords.
+ */
+template <typename B = int, typename R = float>
+class Decoder_RS_fast : public Decoder_RS<B,R>
+{
+public:
+	using typename Decoder_RS<B,R>::S; // symbol to represent data
+
+private:
+	const int t2;
+
+protected:
+	std::vector<S>             YH_N_fast;       // hard decision symbols of the frames
+	std::vector<B>             YH_Nb_fast;      // hard decision bits of the frames
+	mipp::vector<mipp::Reg<S>> Y_N_reorderered; // symbols reordered in the SIMD lanes
+	mipp::vector<mipp::Reg<S>> s;               // syndromes (polynomial form)
+	mipp::vector<mipp::Reg<S>> reg;             // Chien search registers (polynomial form)
+
+	std::vector<S>   s_lanes;   // syndromes of each frame (polynomial form)
+	std::vector<S>   elp_lanes; // error location polynomial of each frame (polynomial form)
+	std::vector<int> l_lanes;   // degree of the error location polynomial of each frame (-1 if no correction)
+	std::vector<int> loc_lanes; // error locations of each frame
+	std::vector<int> n_roots;   // number of roots of the error location polynomial of each frame
+
+	std::vector<int> elp, elp_prev, elp_tmp, omega;
+
+	std::vector<tools::Galois_linear_map<S>> mul_a_i;  // multiplications by alpha^i (syndromes and Chien search)
+	std::vector<tools::Galois_linear_map<S>> mul_a_i0; // multiplications by alpha^(i*i0) (start of the Chien search)
+
+public:
+	Decoder_RS_fast(const int& K, const int& N, const tools::RS_polynomial_generator &GF, const int n_frames = 1);
+	virtual ~Decoder_RS_fast() = default;
+
+protected:
+	virtual void _decode        (      S *Y_N,         const int frame_id);
+	virtual void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	virtual void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+	virtual void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	virtual void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+	void _load (const B *Y_N               );
+	void _store(      B *V,  const bool cw);
+
+private:
+	bool berlekamp_massey(const int f);
+	bool forney          (const int f, S *Y_N);
+};
+}
+}
+
+#endif /* DECODER_RS_FAST */
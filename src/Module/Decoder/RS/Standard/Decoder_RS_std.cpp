@@ -22,33 +22,26 @@ Decoder_RS_std<B,R>
   root           (this->t +1                                    ),
   reg            (this->t +1                                    ),
   z              (this->t +1                                    ),
-  err            (this->N_p2_1                                  )
+  err            (this->N_p2_1                                  ),
+  mul_a_i        (t2+1                                          )
 {
 	const std::string name = "Decoder_RS_std";
 	this->set_name(name);
+
+	for (auto i = 1; i <= t2; i++)
+		this->mul_a_i[i] = tools::Galois_linear_map<S>::mul(this->alpha_to, i);
 }
 
 template <typename B, typename R>
 void Decoder_RS_std<B,R>
 ::_decode(S *Y_N, const int frame_id)
 {
-	bool syn_error = false;
-
 	// first form the syndromes
-	for (auto i = 1; i <= t2; i++)
-	{
-		s[i] = 0;
-		for (auto j = 0; j < this->N_rs; j++)
-		{
-			auto y_idx = this->index_of[Y_N[j]];
-			if (y_idx != -1)
-				s[i] ^= this->alpha_to[(y_idx + i * j) % this->N_p2_1];
-		}
-
-		syn_error |= s[i] != 0; // set error flag if non-zero syndrome
+	const auto syn_error = tools::gf_syndromes(Y_N, this->N_rs, this->mul_a_i, t2, s.data());
 
-		s[i] = this->index_of[s[i]]; // convert syndrome from polynomial form to index form
-	}
+	// convert syndrome from polynomial form to index form
+	for (auto i = 1; i <= t2; i++)
+		s[i] = this->index_of[s[i]];
 
 	this->last_is_codeword = !syn_error;
 
@@ -163,12 +156,14 @@ void Decoder_RS_std<B,R>
 			for (auto i = 0; i <= l[u]; i++)
 				elp[u][i] = this->index_of[elp[u][i]];
 
-			// Chien search: find roots of the error location polynomial
+			// Chien search: find roots of the error location polynomial, only on the positions of the (shortened)
+			// codeword
+			const auto i0 = this->N_p2_1 - this->N_rs;
 			for (auto i = 1; i <= l[u]; i++)
-				reg[i] = elp[u][i];
+				reg[i] = elp[u][i] != -1 ? (elp[u][i] + i * i0) % this->N_p2_1 : -1;
 
 			int count = 0;
-			for (auto i = 1; i <= this->N_p2_1; i++)
+			for (auto i = i0 +1; i <= this->N_p2_1; i++)
 			{
 				q = 1;
 				for (auto j = 1; j <= l[u]; j++)
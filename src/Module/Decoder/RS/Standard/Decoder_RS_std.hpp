@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "Tools/Code/RS/RS_polynomial_generator.hpp"
+#include "Tools/Math/Galois_kernels.hpp"
 #include "Module/Decoder/RS/Decoder_RS.hpp"
 
 /* source : http://www.eccpage.com/  */
@@ -31,6 +32,7 @@ private:
 	std::vector<int> reg;
 	std::vector<int> z;
 	std::vector<int> err;
+	std::vector<tools::Galois_linear_map<S>> mul_a_i; // multiplications by alpha^i (syndromes)
 
 public:
 	Decoder_RS_std(const int& K, const int& N, const tools::RS_polynomial_generator &GF, const int n_frames = 1);
@@ -0,0 +1,63 @@
+#ifndef DECODER_RSC_BCJR_INTER_GENERIC_HPP_
+#define DECODER_RSC_BCJR_INTER_GENERIC_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+#include "Module/Decoder/RSC/BCJR/Decoder_RSC_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RSC_BCJR_inter_generic
+ *
+ * \brief Inter-frame SIMD BCJR for any trellis with 'N_STATES' states.
+ *
+ * The number of states is known at compile time: the state loops are fully unrolled and the trellis connections are
+ * specialized at the construction. One SIMD lane processes one frame.
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i, int N_STATES = 8>
+class Decoder_RSC_BCJR_inter_generic : public Decoder_RSC_BCJR<B,R>
+{
+protected:
+	int a_prev[2][N_STATES]; // previous states in the forward recursion (+gamma, -gamma)
+	int a_gam [2][N_STATES]; // gamma indexes in the forward recursion   (+gamma, -gamma)
+	int b_next[2][N_STATES]; // next states for the bit 0 and for the bit 1
+	int b_gam [2][N_STATES]; // gamma indexes for the bit 0 and for the bit 1
+
+	mipp::vector<R> alpha;    // node metrics (left to right), stored per trellis section
+	mipp::vector<R> gamma[2]; // edge metrics
+
+public:
+	Decoder_RSC_BCJR_inter_generic(const int &K,
+	                               const std::vector<std::vector<int>> &trellis,
+	                               const bool buffered_encoding = true,
+	                               const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_inter_generic() = default;
+
+protected:
+	Decoder_RSC_BCJR_inter_generic(const int &K,
+	                               const std::vector<std::vector<int>> &trellis,
+	                               const bool buffered_encoding,
+	                               const int n_frames,
+	                               const int simd_inter_frame_level);
+
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	// the recursions work on 'n_sec' trellis sections of the given buffers, one SIMD lane per trellis
+	void compute_gamma   (const R *sys, const R *par, R *gamma0, R *gamma1, const int n_sec) const;
+	void compute_alpha   (const mipp::Reg<R> r_init[N_STATES], const R *gamma0, const R *gamma1, R *alpha,
+	                      const int n_sec) const;
+	void compute_beta_ext(const mipp::Reg<R> r_init[N_STATES], const R *gamma0, const R *gamma1, const R *alpha,
+	                      const R *sys, R *ext, const int n_sec, const int n_ext,
+	                      mipp::Reg<R> r_save[N_STATES] = nullptr, const int i_save = -1) const;
+};
+}
+}
+
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_generic.hxx"
+
+#endif /* DECODER_RSC_BCJR_INTER_GENERIC_HPP_ */
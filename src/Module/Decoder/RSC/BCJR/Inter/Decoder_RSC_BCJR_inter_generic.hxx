@@ -0,0 +1,258 @@
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES
+#endif
+#include <sstream>
+#include <string>
+#include <limits>
+#include <cmath>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter.hpp"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_generic.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R>
+struct RSC_BCJR_inter_generic_init
+{
+	static R inf() { return -std::numeric_limits<R>::max(); }
+};
+
+template <>
+struct RSC_BCJR_inter_generic_init <short>
+{
+	static short inf() { return -(1 << (sizeof(short) * 8 -2)); }
+};
+
+template <>
+struct RSC_BCJR_inter_generic_init <signed char>
+{
+	static signed char inf() { return -127; }
+};
+
+template <typename R>
+struct RSC_BCJR_inter_generic_normalize
+{
+	static void apply(mipp::Reg<R> *metrics, const int &n_states, const int &i)
+	{
+		// no need to do something
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_generic_normalize <short>
+{
+	static void apply(mipp::Reg<short> *metrics, const int &n_states, const int &i)
+	{
+		// normalization
+		if (i % 8 == 0)
+		{
+			const auto r_norm_val = metrics[0];
+			for (auto j = 0; j < n_states; j++)
+				metrics[j] -= r_norm_val;
+		}
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_generic_normalize <signed char>
+{
+	static void apply(mipp::Reg<signed char> *metrics, const int &n_states, const int &i)
+	{
+		// normalization
+		const auto r_norm_val = metrics[0];
+		for (auto j = 0; j < n_states; j++)
+			metrics[j] -= r_norm_val;
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+Decoder_RSC_BCJR_inter_generic<B,R,MAX,N_STATES>
+::Decoder_RSC_BCJR_inter_generic(const int &K,
+                                 const std::vector<std::vector<int>> &trellis,
+                                 const bool buffered_encoding,
+                                 const int n_frames)
+: Decoder_RSC_BCJR_inter_generic<B,R,MAX,N_STATES>(K, trellis, buffered_encoding, n_frames,
+                                                   mipp::nElmtsPerRegister<R>())
+{
+	alpha.resize((K + this->n_ff +1) * N_STATES * mipp::nElmtsPerRegister<R>());
+	for (auto i = 0; i < 2; i++) gamma[i].resize((K + this->n_ff) * mipp::nElmtsPerRegister<R>());
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+Decoder_RSC_BCJR_inter_generic<B,R,MAX,N_STATES>
+::Decoder_RSC_BCJR_inter_generic(const int &K,
+                                 const std::vector<std::vector<int>> &trellis,
+                                 const bool buffered_encoding,
+                                 const int n_frames,
+                                 const int simd_inter_frame_level)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, simd_inter_frame_level),
+  Decoder_RSC_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, simd_inter_frame_level)
+{
+	const std::string name = "Decoder_RSC_BCJR_inter_generic";
+	this->set_name(name);
+
+	if (this->n_states != N_STATES)
+	{
+		std::stringstream message;
+		message << "'n_states' has to be equal to 'N_STATES' ('n_states' = " << this->n_states
+		        << ", 'N_STATES' = " << N_STATES << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// specialize the trellis connections: the branch with the '+gamma' is always the first one
+	for (auto j = 0; j < N_STATES; j++)
+	{
+		if (trellis[1][j] == trellis[4][j])
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Unsupported trellis.");
+
+		const auto p = trellis[1][j] == +1 ? 0 : 1;
+		a_prev[p   ][j] = trellis[0][j];
+		a_gam [p   ][j] = trellis[2][j];
+		a_prev[1 -p][j] = trellis[3][j];
+		a_gam [1 -p][j] = trellis[5][j];
+
+		b_next[0][j] = trellis[6][j];
+		b_gam [0][j] = trellis[7][j];
+		b_next[1][j] = trellis[8][j];
+		b_gam [1][j] = trellis[9][j];
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_inter_generic<B,R,MAX,N_STATES>
+::compute_gamma(const R *sys, const R *par, R *gamma0, R *gamma1, const int n_sec) const
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	for (auto i = 0; i < n_sec * stride; i += stride)
+	{
+		const auto r_sys = mipp::Reg<R>(&sys[i]);
+		const auto r_par = mipp::Reg<R>(&par[i]);
+
+		// there is a big loss of precision here in fixed point
+		const auto r_g0 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par);
+		const auto r_g1 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par);
+
+		r_g0.store(&gamma0[i]);
+		r_g1.store(&gamma1[i]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_inter_generic<B,R,MAX,N_STATES>
+::compute_alpha(const mipp::Reg<R> r_init[N_STATES], const R *gamma0, const R *gamma1, R *alpha,
+                const int n_sec) const
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	mipp::Reg<R> r_a[N_STATES], r_a_next[N_STATES];
+	for (auto j = 0; j < N_STATES; j++)
+	{
+		r_a[j] = r_init[j];
+		r_a[j].store(&alpha[j * stride]);
+	}
+
+	// compute alpha values [trellis forward traversal ->]
+	for (auto i = 0; i < n_sec; i++)
+	{
+		const mipp::Reg<R> r_g[2] = {mipp::Reg<R>(&gamma0[i * stride]),
+		                             mipp::Reg<R>(&gamma1[i * stride])};
+
+		for (auto j = 0; j < N_STATES; j++)
+			r_a_next[j] = MAX(r_a[a_prev[0][j]] + r_g[a_gam[0][j]], r_a[a_prev[1][j]] - r_g[a_gam[1][j]]);
+
+		RSC_BCJR_inter_generic_normalize<R>::apply(r_a_next, N_STATES, i +1);
+
+		for (auto j = 0; j < N_STATES; j++)
+		{
+			r_a[j] = r_a_next[j];
+			r_a[j].store(&alpha[((i +1) * N_STATES + j) * stride]);
+		}
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_inter_generic<B,R,MAX,N_STATES>
+::compute_beta_ext(const mipp::Reg<R> r_init[N_STATES], const R *gamma0, const R *gamma1, const R *alpha,
+                   const R *sys, R *ext, const int n_sec, const int n_ext, mipp::Reg<R> r_save[N_STATES],
+                   const int i_save) const
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	mipp::Reg<R> r_b[N_STATES], r_b_prev[N_STATES];
+	for (auto j = 0; j < N_STATES; j++)
+		r_b[j] = r_init[j];
+
+	// compute beta values [trellis backward traversal <-] + compute extrinsic values
+	for (auto i = n_sec -1; i >= 0; i--)
+	{
+		const mipp::Reg<R> r_g[2] = {mipp::Reg<R>(&gamma0[i * stride]),
+		                             mipp::Reg<R>(&gamma1[i * stride])};
+
+		if (i < n_ext)
+		{
+			auto r_a    = mipp::Reg<R>(&alpha[(i * N_STATES +0) * stride]);
+			auto r_max0 = r_a + r_b[b_next[0][0]] + r_g[b_gam[0][0]];
+			auto r_max1 = r_a + r_b[b_next[1][0]] - r_g[b_gam[1][0]];
+			for (auto j = 1; j < N_STATES; j++)
+			{
+				r_a    = mipp::Reg<R>(&alpha[(i * N_STATES + j) * stride]);
+				r_max0 = MAX(r_max0, r_a + r_b[b_next[0][j]] + r_g[b_gam[0][j]]);
+				r_max1 = MAX(r_max1, r_a + r_b[b_next[1][j]] - r_g[b_gam[1][j]]);
+			}
+
+			const auto r_post = RSC_BCJR_inter_post<R>::compute(r_max0 - r_max1);
+			const auto r_ext  = r_post - &sys[i * stride];
+			r_ext.store(&ext[i * stride]);
+		}
+
+		if (i == 0)
+			break;
+
+		for (auto j = 0; j < N_STATES; j++)
+			r_b_prev[j] = MAX(r_b[b_next[0][j]] + r_g[b_gam[0][j]], r_b[b_next[1][j]] - r_g[b_gam[1][j]]);
+
+		RSC_BCJR_inter_generic_normalize<R>::apply(r_b_prev, N_STATES, i);
+
+		for (auto j = 0; j < N_STATES; j++)
+			r_b[j] = r_b_prev[j];
+
+		// the caller can get the backward metrics of the section 'i_save'
+		if (i == i_save)
+			for (auto j = 0; j < N_STATES; j++)
+				r_save[j] = r_b[j];
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_inter_generic<B,R,MAX,N_STATES>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	if (!mipp::isAligned(sys))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'sys' is misaligned memory.");
+
+	if (!mipp::isAligned(par))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'par' is misaligned memory.");
+
+	if (!mipp::isAligned(ext))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'ext' is misaligned memory.");
+
+	const auto n_sec = this->K + this->n_ff;
+
+	// the trellis starts and ends in the state 0
+	mipp::Reg<R> r_init[N_STATES];
+	r_init[0] = mipp::Reg<R>((R)0);
+	for (auto j = 1; j < N_STATES; j++)
+		r_init[j] = mipp::Reg<R>(RSC_BCJR_inter_generic_init<R>::inf());
+
+	this->compute_gamma   (sys, par, this->gamma[0].data(), this->gamma[1].data(), n_sec);
+	this->compute_alpha   (r_init, this->gamma[0].data(), this->gamma[1].data(), this->alpha.data(), n_sec);
+	this->compute_beta_ext(r_init, this->gamma[0].data(), this->gamma[1].data(), this->alpha.data(), sys, ext,
+	                       n_sec, this->K);
+}
+}
+}
@@ -0,0 +1,79 @@
+#ifndef DECODER_RSC_BCJR_INTER_WINDOW_HPP_
+#define DECODER_RSC_BCJR_INTER_WINDOW_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+#include "Module/Decoder/RSC/BCJR/Decoder_RSC_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RSC_BCJR_inter_window
+ *
+ * \brief Sliding-window BCJR (inter-frame SIMD, 8-state trellis).
+ *
+ * The frame is processed by windows of 'window' trellis sections: the forward metrics (alpha) are only stored for the
+ * current window and the backward metrics (beta) are never stored. The backward recursion of a window starts
+ * 'warm_up' sections after its end, from the metrics computed at the same position during the previous call
+ * (next-iteration initialization, only between two 'reset()' calls: a turbo decoder resets its SISOs at each frame).
+ * With 'radix4', the recursions and the extrinsic computation go through two trellis sections per step (each state is
+ * linked to 4 states two sections away) and the forward metrics are only stored every two sections.
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_inter_window : public Decoder_RSC_BCJR<B,R>
+{
+protected:
+	const int  window;  // number of trellis sections per window
+	const int  warm_up; // number of trellis sections to warm up the backward recursion
+	const bool radix4;  // merge two trellis sections per step
+
+	mipp::vector<R> alpha[8]; // node metrics of the current window (left to right)
+	mipp::vector<R> nii  [8]; // backward node metrics at the warm-up start of each window (next-iteration init.)
+	bool            nii_valid;
+	bool            nii_enabled; // the NII is only used between two 'reset()' calls (the iterations of one frame)
+
+public:
+	Decoder_RSC_BCJR_inter_window(const int &K,
+	                              const std::vector<std::vector<int>> &trellis,
+	                              const int window = 64,
+	                              const int warm_up = 32,
+	                              const bool radix4 = false,
+	                              const bool buffered_encoding = true,
+	                              const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_inter_window() = default;
+
+	int get_window () const;
+	int get_warm_up() const;
+	bool is_radix4 () const;
+
+	virtual void reset();
+
+protected:
+	void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	inline void step_alpha(const mipp::Reg<R> a_in[8], mipp::Reg<R> a_out[8], const R *sys, const R *par,
+	                       const int k) const;
+	inline void step_beta (const mipp::Reg<R> b_in[8], mipp::Reg<R> b_out[8], const R *sys, const R *par,
+	                       const int k) const;
+
+	inline void step_alpha_r4(const mipp::Reg<R> a_in[8], mipp::Reg<R> a_out[8], const R *sys, const R *par,
+	                          const int k) const;
+	inline void step_beta_r4 (const mipp::Reg<R> b_in[8], mipp::Reg<R> b_out[8], const R *sys, const R *par,
+	                          const int k) const;
+
+	inline void compute_ext_r2(const mipp::Reg<R> a[8], const mipp::Reg<R> b[8], const R *sys, const R *par,
+	                           R *ext, const int k) const;
+	inline void compute_ext_r4(const mipp::Reg<R> a[8], const mipp::Reg<R> b[8], const R *sys, const R *par,
+	                           R *ext, const int k) const;
+};
+}
+}
+
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_window.hxx"
+
+#endif /* DECODER_RSC_BCJR_INTER_WINDOW_HPP_ */
@@ -0,0 +1,460 @@
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <limits>
+#include <cmath>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter.hpp"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_window.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R>
+struct RSC_BCJR_inter_window_init
+{
+	static R inf() { return -std::numeric_limits<R>::max(); }
+};
+
+template <>
+struct RSC_BCJR_inter_window_init <short>
+{
+	static short inf() { return -(1 << (sizeof(short) * 8 -2)); }
+};
+
+template <>
+struct RSC_BCJR_inter_window_init <signed char>
+{
+	static signed char inf() { return -127; }
+};
+
+template <typename R>
+struct RSC_BCJR_inter_window_normalize
+{
+	static void apply(mipp::Reg<R> metrics[8])
+	{
+		// no need to do something
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_window_normalize <short>
+{
+	static void apply(mipp::Reg<short> metrics[8])
+	{
+		const auto r_norm_val = metrics[0];
+		for (auto j = 0; j < 8; j++)
+			metrics[j] -= r_norm_val;
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_window_normalize <signed char>
+{
+	static void apply(mipp::Reg<signed char> metrics[8])
+	{
+		const auto r_norm_val = metrics[0];
+		for (auto j = 0; j < 8; j++)
+			metrics[j] -= r_norm_val;
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::Decoder_RSC_BCJR_inter_window(const int &K,
+                                const std::vector<std::vector<int>> &trellis,
+                                const int window,
+                                const int warm_up,
+                                const bool radix4,
+                                const bool buffered_encoding,
+                                const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, mipp::N<R>()),
+  Decoder_RSC_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, mipp::nElmtsPerRegister<R>()),
+  window(std::min(window, K)), warm_up(warm_up), radix4(radix4), nii_valid(false), nii_enabled(false)
+{
+	const std::string name = "Decoder_RSC_BCJR_inter_window";
+	this->set_name(name);
+
+	if (window <= 0)
+	{
+		std::stringstream message;
+		message << "'window' has to be greater than 0 ('window' = " << window << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (warm_up < 0 || warm_up > this->window)
+	{
+		std::stringstream message;
+		message << "'warm_up' has to be positive and smaller or equal to 'window' ('warm_up' = " << warm_up
+		        << ", 'window' = " << this->window << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (radix4 && (K % 2 || this->window % 2 || warm_up % 2))
+	{
+		std::stringstream message;
+		message << "'K', 'window' and 'warm_up' have to be even in radix-4 ('K' = " << K << ", 'window' = "
+		        << this->window << ", 'warm_up' = " << warm_up << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<std::vector<int>> req_trellis(10, std::vector<int>(8));
+	req_trellis[0] = { 0,  2,  4,  6,  0,  2,  4,  6};
+	req_trellis[1] = { 1, -1,  1, -1, -1,  1, -1,  1};
+	req_trellis[2] = { 0,  1,  1,  0,  0,  1,  1,  0};
+	req_trellis[3] = { 1,  3,  5,  7,  1,  3,  5,  7};
+	req_trellis[4] = {-1,  1, -1,  1,  1, -1,  1, -1};
+	req_trellis[5] = { 0,  1,  1,  0,  0,  1,  1,  0};
+	req_trellis[6] = { 0,  4,  5,  1,  2,  6,  7,  3};
+	req_trellis[7] = { 0,  0,  1,  1,  1,  1,  0,  0};
+	req_trellis[8] = { 4,  0,  1,  5,  6,  2,  3,  7};
+	req_trellis[9] = { 0,  0,  1,  1,  1,  1,  0,  0};
+
+	for (unsigned i = 0; i < req_trellis.size(); i++)
+		if (trellis[i] != req_trellis[i])
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Unsupported trellis.");
+
+	const auto n_windows = (K + this->window -1) / this->window;
+	const auto n_alpha   = this->window / (radix4 ? 2 : 1);
+	for (auto i = 0; i < 8; i++) alpha[i].resize(n_alpha   * mipp::nElmtsPerRegister<R>());
+	for (auto i = 0; i < 8; i++) nii  [i].resize(n_windows * mipp::nElmtsPerRegister<R>());
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+int Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::get_window() const
+{
+	return this->window;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+int Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::get_warm_up() const
+{
+	return this->warm_up;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+bool Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::is_radix4() const
+{
+	return this->radix4;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::reset()
+{
+	this->nii_valid   = false;
+	this->nii_enabled = true;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	// a standalone frame is not initialized by the metrics of the previous one
+	this->nii_valid   = false;
+	this->nii_enabled = false;
+
+	Decoder_RSC_BCJR<B,R>::_decode_siho(Y_N, V_K, frame_id);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::step_alpha(const mipp::Reg<R> a_in[8], mipp::Reg<R> a_out[8], const R *sys, const R *par, const int k) const
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	constexpr int idx_a1[8] = {0, 3, 4, 7, 1, 2, 5, 6};
+	constexpr int idx_a2[8] = {1, 2, 5, 6, 0, 3, 4, 7};
+	constexpr int idx_g1[8] = {0, 1, 1, 0, 0, 1, 1, 0};
+
+	const auto r_sys = mipp::Reg<R>(&sys[k * stride]);
+	const auto r_par = mipp::Reg<R>(&par[k * stride]);
+	const mipp::Reg<R> r_g[2] = {RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par),
+	                             RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par)};
+
+	for (auto j = 0; j < 8; j++)
+		a_out[j] = MAX(a_in[idx_a1[j]] + r_g[idx_g1[j]], a_in[idx_a2[j]] - r_g[idx_g1[j]]);
+
+	RSC_BCJR_inter_window_normalize<R>::apply(a_out);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::step_beta(const mipp::Reg<R> b_in[8], mipp::Reg<R> b_out[8], const R *sys, const R *par, const int k) const
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	constexpr int idx_b1[8] = {0, 4, 5, 1, 2, 6, 7, 3};
+	constexpr int idx_b2[8] = {4, 0, 1, 5, 6, 2, 3, 7};
+	constexpr int idx_g2[8] = {0, 0, 1, 1, 1, 1, 0, 0};
+
+	const auto r_sys = mipp::Reg<R>(&sys[k * stride]);
+	const auto r_par = mipp::Reg<R>(&par[k * stride]);
+	const mipp::Reg<R> r_g[2] = {RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par),
+	                             RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par)};
+
+	for (auto j = 0; j < 8; j++)
+		b_out[j] = MAX(b_in[idx_b1[j]] + r_g[idx_g2[j]], b_in[idx_b2[j]] - r_g[idx_g2[j]]);
+
+	RSC_BCJR_inter_window_normalize<R>::apply(b_out);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::step_alpha_r4(const mipp::Reg<R> a_in[8], mipp::Reg<R> a_out[8], const R *sys, const R *par, const int k) const
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	constexpr int idx_a [2][8] = {{0, 3, 4, 7, 1, 2, 5, 6}, {1, 2, 5, 6, 0, 3, 4, 7}};
+	constexpr int idx_g1[8]    =  {0, 1, 1, 0, 0, 1, 1, 0};
+
+	const auto r_sys0 = mipp::Reg<R>(&sys[(k +0) * stride]);
+	const auto r_par0 = mipp::Reg<R>(&par[(k +0) * stride]);
+	const auto r_sys1 = mipp::Reg<R>(&sys[(k +1) * stride]);
+	const auto r_par1 = mipp::Reg<R>(&par[(k +1) * stride]);
+	const mipp::Reg<R> r_g0[2] = {RSC_BCJR_inter_div_or_not<R>::apply(r_sys0 + r_par0),
+	                              RSC_BCJR_inter_div_or_not<R>::apply(r_sys0 - r_par0)};
+	const mipp::Reg<R> r_g1[2] = {RSC_BCJR_inter_div_or_not<R>::apply(r_sys1 + r_par1),
+	                              RSC_BCJR_inter_div_or_not<R>::apply(r_sys1 - r_par1)};
+
+	// each state is reached from 4 states two sections before: the 4 paths are compared at once
+	for (auto j = 0; j < 8; j++)
+	{
+		mipp::Reg<R> r_m[4];
+		for (auto u1 = 0; u1 < 2; u1++)
+		{
+			const auto s1 = idx_a[u1][j];
+			for (auto u0 = 0; u0 < 2; u0++)
+			{
+				const auto s0   = idx_a[u0][s1];
+				const auto r_m0 = u0 ? a_in[s0] - r_g0[idx_g1[s1]] : a_in[s0] + r_g0[idx_g1[s1]];
+				r_m[2*u1 + u0]  = u1 ? r_m0     - r_g1[idx_g1[j ]] : r_m0     + r_g1[idx_g1[j ]];
+			}
+		}
+		a_out[j] = MAX(MAX(r_m[0], r_m[1]), MAX(r_m[2], r_m[3]));
+	}
+
+	RSC_BCJR_inter_window_normalize<R>::apply(a_out);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::step_beta_r4(const mipp::Reg<R> b_in[8], mipp::Reg<R> b_out[8], const R *sys, const R *par, const int k) const
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	constexpr int idx_b [2][8] = {{0, 4, 5, 1, 2, 6, 7, 3}, {4, 0, 1, 5, 6, 2, 3, 7}};
+	constexpr int idx_g2[8]    =  {0, 0, 1, 1, 1, 1, 0, 0};
+
+	const auto r_sys0 = mipp::Reg<R>(&sys[(k +0) * stride]);
+	const auto r_par0 = mipp::Reg<R>(&par[(k +0) * stride]);
+	const auto r_sys1 = mipp::Reg<R>(&sys[(k +1) * stride]);
+	const auto r_par1 = mipp::Reg<R>(&par[(k +1) * stride]);
+	const mipp::Reg<R> r_g0[2] = {RSC_BCJR_inter_div_or_not<R>::apply(r_sys0 + r_par0),
+	                              RSC_BCJR_inter_div_or_not<R>::apply(r_sys0 - r_par0)};
+	const mipp::Reg<R> r_g1[2] = {RSC_BCJR_inter_div_or_not<R>::apply(r_sys1 + r_par1),
+	                              RSC_BCJR_inter_div_or_not<R>::apply(r_sys1 - r_par1)};
+
+	// each state leads to 4 states two sections after: the 4 paths are compared at once
+	for (auto j = 0; j < 8; j++)
+	{
+		mipp::Reg<R> r_m[4];
+		for (auto u0 = 0; u0 < 2; u0++)
+		{
+			const auto s1 = idx_b[u0][j];
+			for (auto u1 = 0; u1 < 2; u1++)
+			{
+				const auto s2   = idx_b[u1][s1];
+				const auto r_m1 = u1 ? b_in[s2] - r_g1[idx_g2[s1]] : b_in[s2] + r_g1[idx_g2[s1]];
+				r_m[2*u0 + u1]  = u0 ? r_m1     - r_g0[idx_g2[j ]] : r_m1     + r_g0[idx_g2[j ]];
+			}
+		}
+		b_out[j] = MAX(MAX(r_m[0], r_m[1]), MAX(r_m[2], r_m[3]));
+	}
+
+	RSC_BCJR_inter_window_normalize<R>::apply(b_out);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::compute_ext_r2(const mipp::Reg<R> a[8], const mipp::Reg<R> b[8], const R *sys, const R *par, R *ext,
+                 const int k) const
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	constexpr int idx_b1[8] = {0, 4, 5, 1, 2, 6, 7, 3};
+	constexpr int idx_b2[8] = {4, 0, 1, 5, 6, 2, 3, 7};
+	constexpr int idx_g2[8] = {0, 0, 1, 1, 1, 1, 0, 0};
+
+	const auto r_sys = mipp::Reg<R>(&sys[k * stride]);
+	const auto r_par = mipp::Reg<R>(&par[k * stride]);
+	const mipp::Reg<R> r_g[2] = {RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par),
+	                             RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par)};
+
+	auto r_max0 = a[0] + b[idx_b1[0]] + r_g[idx_g2[0]];
+	auto r_max1 = a[0] + b[idx_b2[0]] - r_g[idx_g2[0]];
+	for (auto j = 1; j < 8; j++)
+	{
+		r_max0 = MAX(r_max0, a[j] + b[idx_b1[j]] + r_g[idx_g2[j]]);
+		r_max1 = MAX(r_max1, a[j] + b[idx_b2[j]] - r_g[idx_g2[j]]);
+	}
+
+	const auto r_post = RSC_BCJR_inter_post<R>::compute(r_max0 - r_max1);
+	const auto r_ext  = r_post - r_sys;
+	r_ext.store(&ext[k * stride]);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::compute_ext_r4(const mipp::Reg<R> a[8], const mipp::Reg<R> b[8], const R *sys, const R *par, R *ext,
+                 const int k) const
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	constexpr int idx_b [2][8] = {{0, 4, 5, 1, 2, 6, 7, 3}, {4, 0, 1, 5, 6, 2, 3, 7}};
+	constexpr int idx_g2[8]    =  {0, 0, 1, 1, 1, 1, 0, 0};
+
+	const auto r_sys0 = mipp::Reg<R>(&sys[(k +0) * stride]);
+	const auto r_par0 = mipp::Reg<R>(&par[(k +0) * stride]);
+	const auto r_sys1 = mipp::Reg<R>(&sys[(k +1) * stride]);
+	const auto r_par1 = mipp::Reg<R>(&par[(k +1) * stride]);
+	const mipp::Reg<R> r_g0[2] = {RSC_BCJR_inter_div_or_not<R>::apply(r_sys0 + r_par0),
+	                              RSC_BCJR_inter_div_or_not<R>::apply(r_sys0 - r_par0)};
+	const mipp::Reg<R> r_g1[2] = {RSC_BCJR_inter_div_or_not<R>::apply(r_sys1 + r_par1),
+	                              RSC_BCJR_inter_div_or_not<R>::apply(r_sys1 - r_par1)};
+
+	// the 32 paths of the merged sections are split depending on the values of the two bits (u0, u1)
+	const auto r_inf = mipp::Reg<R>(RSC_BCJR_inter_window_init<R>::inf());
+	mipp::Reg<R> r_max_u0[2] = {r_inf, r_inf};
+	mipp::Reg<R> r_max_u1[2] = {r_inf, r_inf};
+	for (auto j = 0; j < 8; j++)
+		for (auto u0 = 0; u0 < 2; u0++)
+		{
+			const auto s1   = idx_b[u0][j];
+			const auto r_m0 = u0 ? a[j] - r_g0[idx_g2[j]] : a[j] + r_g0[idx_g2[j]];
+			for (auto u1 = 0; u1 < 2; u1++)
+			{
+				const auto s2  = idx_b[u1][s1];
+				const auto r_m = (u1 ? r_m0 - r_g1[idx_g2[s1]] : r_m0 + r_g1[idx_g2[s1]]) + b[s2];
+
+				r_max_u0[u0] = MAX(r_max_u0[u0], r_m);
+				r_max_u1[u1] = MAX(r_max_u1[u1], r_m);
+			}
+		}
+
+	const auto r_ext0 = RSC_BCJR_inter_post<R>::compute(r_max_u0[0] - r_max_u0[1]) - r_sys0;
+	const auto r_ext1 = RSC_BCJR_inter_post<R>::compute(r_max_u1[0] - r_max_u1[1]) - r_sys1;
+	r_ext0.store(&ext[(k +0) * stride]);
+	r_ext1.store(&ext[(k +1) * stride]);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_window<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	if (!mipp::isAligned(sys))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'sys' is misaligned memory.");
+
+	if (!mipp::isAligned(par))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'par' is misaligned memory.");
+
+	if (!mipp::isAligned(ext))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'ext' is misaligned memory.");
+
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+	const auto r_inf  = mipp::Reg<R>(RSC_BCJR_inter_window_init<R>::inf());
+	const auto r_zero = mipp::Reg<R>((R)0);
+	const auto step   = this->radix4 ? 2 : 1;
+	const auto K      = this->K;
+
+	mipp::Reg<R> r_tmp[8];
+
+	// backward metrics at the end of the frame: the tail bits bring the trellis back to the state 0
+	mipp::Reg<R> r_b_end[8];
+	r_b_end[0] = r_zero;
+	for (auto j = 1; j < 8; j++) r_b_end[j] = r_inf;
+	for (auto k = K +2; k >= K; k--)
+	{
+		this->step_beta(r_b_end, r_tmp, sys, par, k);
+		std::copy(r_tmp, r_tmp + 8, r_b_end);
+	}
+
+	// the forward metrics are carried from one window to the next one
+	mipp::Reg<R> r_a[8];
+	r_a[0] = r_zero;
+	for (auto j = 1; j < 8; j++) r_a[j] = r_inf;
+
+	const auto n_windows = (K + this->window -1) / this->window;
+	for (auto w = 0; w < n_windows; w++)
+	{
+		const auto w0 = w * this->window;
+		const auto w1 = std::min(K, w0 + this->window);
+
+		// forward recursion, store the alpha metrics of the window
+		for (auto k = w0; k < w1; k += step)
+		{
+			for (auto j = 0; j < 8; j++)
+				r_a[j].store(&this->alpha[j][((k - w0) / step) * stride]);
+
+			if (this->radix4)
+				this->step_alpha_r4(r_a, r_tmp, sys, par, k);
+			else
+				this->step_alpha(r_a, r_tmp, sys, par, k);
+			std::copy(r_tmp, r_tmp + 8, r_a);
+		}
+
+		// warm-up of the backward recursion
+		mipp::Reg<R> r_b[8];
+		const auto e = std::min(K, w1 + this->warm_up);
+		for (auto j = 0; j < 8; j++)
+			r_b[j] = (e == K) ? r_b_end[j] : (this->nii_valid ? mipp::Reg<R>(&this->nii[j][w * stride]) : r_zero);
+		for (auto k = e - step; k >= w1; k -= step)
+		{
+			if (this->radix4)
+				this->step_beta_r4(r_b, r_tmp, sys, par, k);
+			else
+				this->step_beta(r_b, r_tmp, sys, par, k);
+			std::copy(r_tmp, r_tmp + 8, r_b);
+		}
+
+		// the metrics at the warm-up start of the previous window are saved for the next call
+		const auto c = (w > 0 && w0 + this->warm_up < K) ? w0 + this->warm_up : -1;
+		if (c == w1)
+			for (auto j = 0; j < 8; j++)
+				r_b[j].store(&this->nii[j][(w -1) * stride]);
+
+		// backward recursion and extrinsic information
+		for (auto k = w1 - step; k >= w0; k -= step)
+		{
+			mipp::Reg<R> r_ak[8];
+			for (auto j = 0; j < 8; j++)
+				r_ak[j] = mipp::Reg<R>(&this->alpha[j][((k - w0) / step) * stride]);
+
+			if (this->radix4)
+			{
+				this->compute_ext_r4(r_ak, r_b, sys, par, ext, k);
+				this->step_beta_r4(r_b, r_tmp, sys, par, k);
+			}
+			else
+			{
+				this->compute_ext_r2(r_ak, r_b, sys, par, ext, k);
+				this->step_beta(r_b, r_tmp, sys, par, k);
+			}
+			std::copy(r_tmp, r_tmp + 8, r_b);
+
+			if (k == c)
+				for (auto j = 0; j < 8; j++)
+					r_b[j].store(&this->nii[j][(w -1) * stride]);
+		}
+	}
+
+	this->nii_valid = this->nii_enabled;
+}
+}
+}
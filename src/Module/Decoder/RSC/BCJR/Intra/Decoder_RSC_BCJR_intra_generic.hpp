@@ -0,0 +1,59 @@
+#ifndef DECODER_RSC_BCJR_INTRA_GENERIC_HPP_
+#define DECODER_RSC_BCJR_INTRA_GENERIC_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+#include "Module/Decoder/RSC/BCJR/Decoder_RSC_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RSC_BCJR_intra_generic
+ *
+ * \brief Intra-frame SIMD BCJR for any trellis with 'N_STATES' states (N_STATES >= SIMD length).
+ *
+ * The SIMD lanes process the states of one trellis section. The metrics of the connected states are gathered with the
+ * trellis connections specialized at the construction, the gamma selection is precomputed in masks.
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i, int N_STATES = 16>
+class Decoder_RSC_BCJR_intra_generic : public Decoder_RSC_BCJR<B,R>
+{
+protected:
+	int a_prev[2][N_STATES]; // previous states in the forward recursion (+gamma, -gamma)
+	int b_next[2][N_STATES]; // next states for the bit 0 and for the bit 1
+
+	mipp::vector<mipp::Msk<mipp::N<R>()>> a_msk[2]; // gamma selection in the forward recursion   (true = gamma 0)
+	mipp::vector<mipp::Msk<mipp::N<R>()>> b_msk[2]; // gamma selection in the backward recursion  (true = gamma 0)
+
+	mipp::vector<R> alpha;    // node metrics (left to right), stored per trellis section
+	mipp::vector<R> beta[2];  // node metrics (right to left), current and next trellis sections
+	mipp::vector<R> gamma[2]; // edge metrics
+	mipp::vector<R> buff[2];  // gathered node metrics
+
+public:
+	Decoder_RSC_BCJR_intra_generic(const int &K,
+	                               const std::vector<std::vector<int>> &trellis,
+	                               const bool buffered_encoding = true,
+	                               const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_intra_generic() = default;
+
+protected:
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	void compute_gamma   (const R *sys, const R *par);
+	void compute_alpha   (                          );
+	void compute_beta_ext(const R *sys,       R *ext);
+
+private:
+	inline mipp::Reg<R> reduce(const mipp::Reg<R> r);
+};
+}
+}
+
+#include "Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra_generic.hxx"
+
+#endif /* DECODER_RSC_BCJR_INTRA_GENERIC_HPP_ */
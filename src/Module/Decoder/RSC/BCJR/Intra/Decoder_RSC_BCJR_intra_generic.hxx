@@ -0,0 +1,256 @@
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES
+#endif
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <limits>
+#include <cmath>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter.hpp"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_generic.hpp"
+#include "Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic.hpp"
+#include "Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra_generic.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R>
+struct RSC_BCJR_intra_generic_normalize
+{
+	static void apply(R *metrics, const int &n_states, const int &i)
+	{
+		// no need to do something
+	}
+};
+
+template <>
+struct RSC_BCJR_intra_generic_normalize <short>
+{
+	static void apply(short *metrics, const int &n_states, const int &i)
+	{
+		// normalization
+		if (i % 8 == 0)
+		{
+			const auto r_norm_val = mipp::Reg<short>(metrics[0]);
+			for (auto j = 0; j < n_states; j += mipp::N<short>())
+			{
+				const auto r_m = mipp::Reg<short>(&metrics[j]) - r_norm_val;
+				r_m.store(&metrics[j]);
+			}
+		}
+	}
+};
+
+template <>
+struct RSC_BCJR_intra_generic_normalize <signed char>
+{
+	static void apply(signed char *metrics, const int &n_states, const int &i)
+	{
+		// normalization
+		const auto r_norm_val = mipp::Reg<signed char>(metrics[0]);
+		for (auto j = 0; j < n_states; j += mipp::N<signed char>())
+		{
+			const auto r_m = mipp::Reg<signed char>(&metrics[j]) - r_norm_val;
+			r_m.store(&metrics[j]);
+		}
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+Decoder_RSC_BCJR_intra_generic<B,R,MAX,N_STATES>
+::Decoder_RSC_BCJR_intra_generic(const int &K,
+                                 const std::vector<std::vector<int>> &trellis,
+                                 const bool buffered_encoding,
+                                 const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, 1),
+  Decoder_RSC_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, 1)
+{
+	const std::string name = "Decoder_RSC_BCJR_intra_generic";
+	this->set_name(name);
+
+	if (this->n_states != N_STATES)
+	{
+		std::stringstream message;
+		message << "'n_states' has to be equal to 'N_STATES' ('n_states' = " << this->n_states
+		        << ", 'N_STATES' = " << N_STATES << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N_STATES % mipp::N<R>())
+	{
+		std::stringstream message;
+		message << "'N_STATES' has to be a multiple of 'mipp::N<R>()' ('N_STATES' = " << N_STATES
+		        << ", 'mipp::N<R>()' = " << mipp::N<R>() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// specialize the trellis connections: the branch with the '+gamma' is always the first one
+	mipp::vector<R> a_sel[2], b_sel[2];
+	for (auto i = 0; i < 2; i++) a_sel[i].resize(N_STATES);
+	for (auto i = 0; i < 2; i++) b_sel[i].resize(N_STATES);
+	for (auto j = 0; j < N_STATES; j++)
+	{
+		if (trellis[1][j] == trellis[4][j])
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Unsupported trellis.");
+
+		const auto p = trellis[1][j] == +1 ? 0 : 1;
+		a_prev[p   ][j] = trellis[0][j];
+		a_sel [p   ][j] = trellis[2][j] == 0 ? (R)1 : (R)0;
+		a_prev[1 -p][j] = trellis[3][j];
+		a_sel [1 -p][j] = trellis[5][j] == 0 ? (R)1 : (R)0;
+
+		b_next[0][j] = trellis[6][j];
+		b_sel [0][j] = trellis[7][j] == 0 ? (R)1 : (R)0;
+		b_next[1][j] = trellis[8][j];
+		b_sel [1][j] = trellis[9][j] == 0 ? (R)1 : (R)0;
+	}
+
+	const auto r_one = mipp::Reg<R>((R)1);
+	for (auto i = 0; i < 2; i++)
+		for (auto j = 0; j < N_STATES; j += mipp::N<R>())
+		{
+			a_msk[i].push_back(mipp::Reg<R>(&a_sel[i][j]) == r_one);
+			b_msk[i].push_back(mipp::Reg<R>(&b_sel[i][j]) == r_one);
+		}
+
+	alpha.resize((K + this->n_ff +1) * N_STATES);
+	for (auto i = 0; i < 2; i++) beta [i].resize(N_STATES);
+	for (auto i = 0; i < 2; i++) gamma[i].resize(K + this->n_ff);
+	for (auto i = 0; i < 2; i++) buff [i].resize(mipp::N<R>());
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+mipp::Reg<R> Decoder_RSC_BCJR_intra_generic<B,R,MAX,N_STATES>
+::reduce(const mipp::Reg<R> r)
+{
+	r.store(this->buff[0].data());
+
+	auto r_red = mipp::Reg<R>(this->buff[0][0]);
+	for (auto l = 1; l < mipp::N<R>(); l++)
+		r_red = MAX(r_red, mipp::Reg<R>(this->buff[0][l]));
+
+	return r_red;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_intra_generic<B,R,MAX,N_STATES>
+::compute_gamma(const R *sys, const R *par)
+{
+	// compute gamma values (auto-vectorized loop)
+	for (auto i = 0; i < this->K + this->n_ff; i++)
+	{
+		// there is a big loss of precision here in fixed point
+		this->gamma[0][i] = RSC_BCJR_seq_generic_div_or_not<R>::apply(sys[i] + par[i]);
+		// there is a big loss of precision here in fixed point
+		this->gamma[1][i] = RSC_BCJR_seq_generic_div_or_not<R>::apply(sys[i] - par[i]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_intra_generic<B,R,MAX,N_STATES>
+::compute_alpha()
+{
+	constexpr auto N = mipp::N<R>();
+
+	this->alpha[0] = (R)0;
+	for (auto j = 1; j < N_STATES; j++)
+		this->alpha[j] = RSC_BCJR_inter_generic_init<R>::inf();
+
+	// compute alpha values [trellis forward traversal ->]
+	for (auto i = 0; i < this->K + this->n_ff; i++)
+	{
+		const auto r_g0 = mipp::Reg<R>(this->gamma[0][i]);
+		const auto r_g1 = mipp::Reg<R>(this->gamma[1][i]);
+
+		const R* a_cur  = &this->alpha[(i +0) * N_STATES];
+		      R* a_next = &this->alpha[(i +1) * N_STATES];
+
+		for (auto c = 0; c < N_STATES; c += N)
+		{
+			// gather the metrics of the previous states
+			for (auto l = 0; l < N; l++)
+			{
+				this->buff[0][l] = a_cur[a_prev[0][c +l]];
+				this->buff[1][l] = a_cur[a_prev[1][c +l]];
+			}
+
+			const auto r_ga = mipp::blend(r_g0, r_g1, a_msk[0][c / N]);
+			const auto r_gb = mipp::blend(r_g0, r_g1, a_msk[1][c / N]);
+
+			const auto r_a = MAX(mipp::Reg<R>(this->buff[0].data()) + r_ga,
+			                     mipp::Reg<R>(this->buff[1].data()) - r_gb);
+			r_a.store(&a_next[c]);
+		}
+
+		RSC_BCJR_intra_generic_normalize<R>::apply(a_next, N_STATES, i +1);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_intra_generic<B,R,MAX,N_STATES>
+::compute_beta_ext(const R *sys, R *ext)
+{
+	constexpr auto N = mipp::N<R>();
+
+	auto b_cur  = this->beta[0].data();
+	auto b_prev = this->beta[1].data();
+
+	b_cur[0] = (R)0;
+	for (auto j = 1; j < N_STATES; j++)
+		b_cur[j] = RSC_BCJR_inter_generic_init<R>::inf();
+
+	// compute beta values [trellis backward traversal <-] + compute extrinsic values
+	for (auto i = this->K + this->n_ff -1; i >= 0; i--)
+	{
+		const auto r_g0 = mipp::Reg<R>(this->gamma[0][i]);
+		const auto r_g1 = mipp::Reg<R>(this->gamma[1][i]);
+
+		mipp::Reg<R> r_max0, r_max1;
+		for (auto c = 0; c < N_STATES; c += N)
+		{
+			// gather the metrics of the next states
+			for (auto l = 0; l < N; l++)
+			{
+				this->buff[0][l] = b_cur[b_next[0][c +l]];
+				this->buff[1][l] = b_cur[b_next[1][c +l]];
+			}
+
+			const auto r_b0 = mipp::Reg<R>(this->buff[0].data()) + mipp::blend(r_g0, r_g1, b_msk[0][c / N]);
+			const auto r_b1 = mipp::Reg<R>(this->buff[1].data()) - mipp::blend(r_g0, r_g1, b_msk[1][c / N]);
+
+			if (i < this->K)
+			{
+				const auto r_a = mipp::Reg<R>(&this->alpha[i * N_STATES + c]);
+				r_max0 = c == 0 ? r_a + r_b0 : MAX(r_max0, r_a + r_b0);
+				r_max1 = c == 0 ? r_a + r_b1 : MAX(r_max1, r_a + r_b1);
+			}
+
+			const auto r_b = MAX(r_b0, r_b1);
+			r_b.store(&b_prev[c]);
+		}
+
+		if (i < this->K)
+		{
+			const auto r_post = RSC_BCJR_inter_post<R>::compute(this->reduce(r_max0) - this->reduce(r_max1));
+			ext[i] = r_post[0] - sys[i];
+		}
+
+		RSC_BCJR_intra_generic_normalize<R>::apply(b_prev, N_STATES, i);
+		std::swap(b_cur, b_prev);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_intra_generic<B,R,MAX,N_STATES>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	this->compute_gamma   (sys, par);
+	this->compute_alpha   (        );
+	this->compute_beta_ext(sys, ext);
+}
+}
+}
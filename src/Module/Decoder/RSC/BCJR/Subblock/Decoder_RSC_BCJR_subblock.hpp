@@ -0,0 +1,90 @@
+#ifndef DECODER_RSC_BCJR_SUBBLOCK_HPP_
+#define DECODER_RSC_BCJR_SUBBLOCK_HPP_
+
+#include <condition_variable>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_generic.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RSC_BCJR_subblock
+ *
+ * \brief Low latency BCJR: one frame is split in sub-blocks decoded in parallel.
+ *
+ * The frame is split in 'n_sub_blocks' sub-blocks of the same size. The sub-blocks are packed in the SIMD lanes (one
+ * sub-block per lane) and the groups of lanes are dispatched on 'n_threads' threads (the calling thread included). The
+ * recursions of a sub-block start from the boundary metrics computed by its neighbours during the previous call
+ * (next-iteration initialization) and the backward recursion overlaps the next sub-block of 'n_ff' sections. The
+ * boundary metrics are only used between two 'reset()' calls. The recursions are the ones of the generic inter-frame
+ * BCJR applied to the sub-blocks of a group.
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i, int N_STATES = 8>
+class Decoder_RSC_BCJR_subblock : public Decoder_RSC_BCJR_inter_generic<B,R,MAX,N_STATES>
+{
+protected:
+	const int n_sub_blocks; // number of sub-blocks per frame
+	const int sub_size;     // number of information bits per sub-block
+	const int n_groups;     // number of groups of SIMD lanes
+	const int n_threads;    // number of threads (the calling thread included)
+
+	std::vector<mipp::vector<R>> sys_g, par_g, ext_g; // LLRs of each group (reordered in the SIMD lanes)
+	std::vector<mipp::vector<R>> alpha_g;             // node metrics of each group (left to right)
+	std::vector<mipp::vector<R>> gamma_g[2];          // edge metrics of each group
+	std::vector<mipp::vector<R>> init_g;              // initial node metrics of each group
+
+	mipp::vector<R>   alpha_bnd[2]; // forward  metrics at the beginning of the sub-blocks (previous and current call)
+	mipp::vector<R>   beta_bnd [2]; // backward metrics at the end of the sub-blocks + overlap (previous and current call)
+	std::vector<int>  bnd_cur;      // per frame
+	std::vector<bool> bnd_valid;    // per frame
+	bool              bnd_enabled;  // the boundaries are only used between two 'reset()' calls (the iterations of a frame)
+
+	const R *cur_sys;
+	const R *cur_par;
+	      R *cur_ext;
+	int      cur_frame;
+
+	std::vector<std::thread> threads;
+	std::mutex               mtx;
+	std::condition_variable  cv_start;
+	std::condition_variable  cv_done;
+	unsigned                 job_id;
+	int                      n_done;
+	bool                     stop;
+
+public:
+	Decoder_RSC_BCJR_subblock(const int &K,
+	                          const std::vector<std::vector<int>> &trellis,
+	                          const int n_sub_blocks,
+	                          const int n_threads = 1,
+	                          const bool buffered_encoding = true,
+	                          const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_subblock();
+
+	int get_n_sub_blocks() const;
+	int get_n_threads   () const;
+
+	virtual void reset();
+
+protected:
+	void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	void decode_group(const int g);
+
+private:
+	void worker(const int tid);
+};
+}
+}
+
+#include "Module/Decoder/RSC/BCJR/Subblock/Decoder_RSC_BCJR_subblock.hxx"
+
+#endif /* DECODER_RSC_BCJR_SUBBLOCK_HPP_ */
@@ -0,0 +1,284 @@
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES
+#endif
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <cmath>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_generic.hpp"
+#include "Module/Decoder/RSC/BCJR/Subblock/Decoder_RSC_BCJR_subblock.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+Decoder_RSC_BCJR_subblock<B,R,MAX,N_STATES>
+::Decoder_RSC_BCJR_subblock(const int &K,
+                            const std::vector<std::vector<int>> &trellis,
+                            const int n_sub_blocks,
+                            const int n_threads,
+                            const bool buffered_encoding,
+                            const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, 1),
+  Decoder_RSC_BCJR_inter_generic<B,R,MAX,N_STATES>(K, trellis, buffered_encoding, n_frames, 1),
+  n_sub_blocks(n_sub_blocks),
+  sub_size    (n_sub_blocks > 0 ? K / n_sub_blocks : 0),
+  n_groups    (n_sub_blocks > 0 ? (n_sub_blocks + mipp::nElReg<R>() -1) / mipp::nElReg<R>() : 0),
+  n_threads   (std::max(1, std::min(n_threads, n_groups))),
+  bnd_cur(n_frames, 0), bnd_valid(n_frames, false), bnd_enabled(false), cur_sys(nullptr), cur_par(nullptr), cur_ext(nullptr), cur_frame(0),
+  job_id(0), n_done(0), stop(false)
+{
+	const std::string name = "Decoder_RSC_BCJR_subblock";
+	this->set_name(name);
+
+	if (n_sub_blocks <= 0)
+	{
+		std::stringstream message;
+		message << "'n_sub_blocks' has to be greater than 0 ('n_sub_blocks' = " << n_sub_blocks << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (K % n_sub_blocks)
+	{
+		std::stringstream message;
+		message << "'K' has to be a multiple of 'n_sub_blocks' ('K' = " << K << ", 'n_sub_blocks' = "
+		        << n_sub_blocks << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+	const auto n_sec = this->sub_size + this->n_ff;
+
+	this->sys_g     .resize(this->n_groups, mipp::vector<R>(n_sec                           * stride));
+	this->par_g     .resize(this->n_groups, mipp::vector<R>(n_sec                           * stride));
+	this->ext_g     .resize(this->n_groups, mipp::vector<R>(this->sub_size                  * stride));
+	this->alpha_g   .resize(this->n_groups, mipp::vector<R>((this->sub_size +1) * N_STATES * stride));
+	this->gamma_g[0].resize(this->n_groups, mipp::vector<R>(n_sec                           * stride));
+	this->gamma_g[1].resize(this->n_groups, mipp::vector<R>(n_sec                           * stride));
+	this->init_g    .resize(this->n_groups, mipp::vector<R>(N_STATES                        * stride));
+
+	for (auto i = 0; i < 2; i++) this->alpha_bnd[i].resize(n_frames * n_sub_blocks * N_STATES);
+	for (auto i = 0; i < 2; i++) this->beta_bnd [i].resize(n_frames * n_sub_blocks * N_STATES);
+
+	// the calling thread is the thread 0
+	for (auto t = 1; t < this->n_threads; t++)
+		this->threads.push_back(std::thread(&Decoder_RSC_BCJR_subblock<B,R,MAX,N_STATES>::worker, this, t));
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+Decoder_RSC_BCJR_subblock<B,R,MAX,N_STATES>
+::~Decoder_RSC_BCJR_subblock()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->stop = true;
+	}
+	this->cv_start.notify_all();
+
+	for (auto &t : this->threads)
+		t.join();
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+int Decoder_RSC_BCJR_subblock<B,R,MAX,N_STATES>
+::get_n_sub_blocks() const
+{
+	return this->n_sub_blocks;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+int Decoder_RSC_BCJR_subblock<B,R,MAX,N_STATES>
+::get_n_threads() const
+{
+	return this->n_threads;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_subblock<B,R,MAX,N_STATES>
+::reset()
+{
+	std::fill(this->bnd_valid.begin(), this->bnd_valid.end(), false);
+	this->bnd_enabled = true;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_subblock<B,R,MAX,N_STATES>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	// a standalone frame is not initialized by the boundaries of the previous one
+	std::fill(this->bnd_valid.begin(), this->bnd_valid.end(), false);
+	this->bnd_enabled = false;
+
+	Decoder_RSC_BCJR<B,R>::_decode_siho(Y_N, V_K, frame_id);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_subblock<B,R,MAX,N_STATES>
+::worker(const int tid)
+{
+	unsigned last_job = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(this->mtx);
+			this->cv_start.wait(lock, [&](){ return this->stop || this->job_id != last_job; });
+			if (this->stop)
+				return;
+			last_job = this->job_id;
+		}
+
+		for (auto g = tid; g < this->n_groups; g += this->n_threads)
+			this->decode_group(g);
+
+		{
+			std::lock_guard<std::mutex> lock(this->mtx);
+			this->n_done++;
+		}
+		this->cv_done.notify_one();
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_subblock<B,R,MAX,N_STATES>
+::decode_group(const int g)
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+	const auto L     = this->sub_size;
+	const auto n_ff  = this->n_ff;
+	const auto n_sec = L + n_ff;
+	const auto P     = this->n_sub_blocks;
+	const auto inf   = RSC_BCJR_inter_generic_init<R>::inf();
+	const auto f     = this->cur_frame;
+	const auto off   = f * P * N_STATES;
+	const auto valid = this->bnd_valid[f];
+
+	auto &sys   = this->sys_g  [g];
+	auto &par   = this->par_g  [g];
+	auto &ext   = this->ext_g  [g];
+	auto &alpha = this->alpha_g[g];
+	auto &init  = this->init_g [g];
+	auto  g0    = this->gamma_g[0][g].data();
+	auto  g1    = this->gamma_g[1][g].data();
+
+	const auto a_bnd_prv = this->alpha_bnd[    this->bnd_cur[f]].data() + off;
+	const auto b_bnd_prv = this->beta_bnd [    this->bnd_cur[f]].data() + off;
+	      auto a_bnd_nxt = this->alpha_bnd[1 - this->bnd_cur[f]].data() + off;
+	      auto b_bnd_nxt = this->beta_bnd [1 - this->bnd_cur[f]].data() + off;
+
+	// reorder the sub-blocks in the SIMD lanes, the backward recursion overlaps the next sub-block of 'n_ff' sections
+	for (auto l = 0; l < stride; l++)
+	{
+		const auto p = g * stride + l;
+		for (auto i = 0; i < n_sec; i++)
+		{
+			sys[i * stride + l] = p < P ? this->cur_sys[p * L + i] : (R)0;
+			par[i * stride + l] = p < P ? this->cur_par[p * L + i] : (R)0;
+		}
+	}
+
+	this->compute_gamma(sys.data(), par.data(), g0, g1, n_sec);
+
+	// initial forward metrics: the first sub-block starts in the state 0, the others from the previous call
+	for (auto l = 0; l < stride; l++)
+	{
+		const auto p = g * stride + l;
+		for (auto j = 0; j < N_STATES; j++)
+			init[j * stride + l] = (p == 0 || p >= P) ? (j == 0 ? (R)0 : inf) :
+			                       (valid ? a_bnd_prv[p * N_STATES + j] : (R)0);
+	}
+
+	mipp::Reg<R> r_init[N_STATES], r_save[N_STATES];
+	for (auto j = 0; j < N_STATES; j++)
+		r_init[j] = mipp::Reg<R>(&init[j * stride]);
+
+	this->compute_alpha(r_init, g0, g1, alpha.data(), L);
+
+	// the forward metrics at the end of the sub-block initialize the next sub-block during the next call
+	for (auto l = 0; l < stride; l++)
+	{
+		const auto p = g * stride + l;
+		if (p +1 < P)
+			for (auto j = 0; j < N_STATES; j++)
+				a_bnd_nxt[(p +1) * N_STATES + j] = alpha[(L * N_STATES + j) * stride + l];
+	}
+
+	// initial backward metrics: the last sub-block ends in the state 0, the others from the previous call
+	for (auto l = 0; l < stride; l++)
+	{
+		const auto p = g * stride + l;
+		for (auto j = 0; j < N_STATES; j++)
+			init[j * stride + l] = (p >= P -1) ? (j == 0 ? (R)0 : inf) :
+			                       (valid ? b_bnd_prv[p * N_STATES + j] : (R)0);
+	}
+
+	for (auto j = 0; j < N_STATES; j++)
+		r_init[j] = mipp::Reg<R>(&init[j * stride]);
+
+	this->compute_beta_ext(r_init, g0, g1, alpha.data(), sys.data(), ext.data(), n_sec, L, r_save, n_ff);
+
+	// the backward metrics after the overlap initialize the previous sub-block during the next call
+	for (auto j = 0; j < N_STATES; j++)
+		r_save[j].store(&init[j * stride]);
+
+	for (auto l = 0; l < stride; l++)
+	{
+		const auto p = g * stride + l;
+		if (p > 0 && p < P)
+			for (auto j = 0; j < N_STATES; j++)
+				b_bnd_nxt[(p -1) * N_STATES + j] = init[j * stride + l];
+	}
+
+	// write the extrinsic values of the sub-blocks in the natural order
+	for (auto l = 0; l < stride; l++)
+	{
+		const auto p = g * stride + l;
+		if (p < P)
+			for (auto i = 0; i < L; i++)
+				this->cur_ext[p * L + i] = ext[i * stride + l];
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX, int N_STATES>
+void Decoder_RSC_BCJR_subblock<B,R,MAX,N_STATES>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	this->cur_sys   = sys;
+	this->cur_par   = par;
+	this->cur_ext   = ext;
+	this->cur_frame = frame_id;
+
+	if (this->n_threads > 1)
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->mtx);
+			this->job_id++;
+			this->n_done = 0;
+		}
+		this->cv_start.notify_all();
+	}
+
+	for (auto g = 0; g < this->n_groups; g += this->n_threads)
+		this->decode_group(g);
+
+	if (this->n_threads > 1)
+	{
+		std::unique_lock<std::mutex> lock(this->mtx);
+		this->cv_done.wait(lock, [&](){ return this->n_done == this->n_threads -1; });
+	}
+
+	this->bnd_cur  [frame_id] = 1 - this->bnd_cur[frame_id];
+	this->bnd_valid[frame_id] = this->bnd_enabled;
+}
+}
+}
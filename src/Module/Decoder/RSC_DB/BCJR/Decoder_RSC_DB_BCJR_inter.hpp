@@ -0,0 +1,46 @@
+#ifndef DECODER_RSC_DB_BCJR_INTER_HPP_
+#define DECODER_RSC_DB_BCJR_INTER_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+#include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RSC_DB_BCJR_inter
+ *
+ * \brief Duo-binary BCJR (inter-frame SIMD, any trellis).
+ *
+ * One frame is decoded per SIMD lane (the number of frames has to be a multiple of the SIMD register size). Only the
+ * 16 distinct branch metrics of each trellis section (4 symbols x 4 parity couples) are computed and stored.
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_DB_BCJR_inter : public Decoder_RSC_DB_BCJR<B,R>
+{
+protected:
+	std::vector<int> prev;   // previous state of each (state, symbol)
+	std::vector<int> next;   // next     state of each (state, symbol)
+	std::vector<int> gam_id; // branch metric index of each (state, symbol) transition
+
+public:
+	Decoder_RSC_DB_BCJR_inter(const int K,
+	                          const std::vector<std::vector<int>> &trellis,
+	                          const bool buffered_encoding = true,
+	                          const int n_frames = mipp::nElReg<R>());
+	virtual ~Decoder_RSC_DB_BCJR_inter() = default;
+
+protected:
+	virtual void __fwd_recursion(const R *sys, const R *par        );
+	virtual void __bwd_recursion(const R *sys, const R *par, R* ext);
+};
+}
+}
+
+#include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_inter.hxx"
+
+#endif /* DECODER_RSC_DB_BCJR_INTER_HPP_ */
@@ -0,0 +1,126 @@
+#include <string>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::Decoder_RSC_DB_BCJR_inter(const int K,
+                            const std::vector<std::vector<int>> &trellis,
+                            const bool buffered_encoding,
+                            const int n_frames)
+: Decoder(K, 2 * K, n_frames, mipp::nElReg<R>()),
+  Decoder_RSC_DB_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, mipp::nElReg<R>()),
+  prev  (this->n_states * 4),
+  next  (this->n_states * 4),
+  gam_id(this->n_states * 4)
+{
+	const std::string name = "Decoder_RSC_DB_BCJR_inter";
+	this->set_name(name);
+
+	if (this->n_states < 4)
+	{
+		std::stringstream message;
+		message << "'n_states' has to be greater or equal to 4 ('n_states' = " << this->n_states << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the branch metric of a transition only depends on the symbol and on the 2 parity bits
+	for (auto i = 0; i < this->n_states * 4; i++)
+	{
+		const auto c = i % 4;
+		prev  [i] = trellis[1][i];
+		next  [i] = trellis[0][i];
+		gam_id[i] = 4 * c + (trellis[2][i] < 0 ? 2 : 0) + (trellis[3][i] < 0 ? 1 : 0);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::__fwd_recursion(const R *sys, const R *par)
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	for (auto k = 0; k < this->K/2; k++)
+	{
+		const auto r_y = mipp::Reg<R>(&par[(2*k  ) * stride]);
+		const auto r_w = mipp::Reg<R>(&par[(2*k+1) * stride]);
+
+		const auto r_pp = r_y + r_w;
+		const auto r_pm = r_y - r_w;
+		const mipp::Reg<R> r_p[4] = {r_pp, r_pm, mipp::Reg<R>((R)0) - r_pm, mipp::Reg<R>((R)0) - r_pp};
+
+		auto &gamma = this->gamma[k];
+		for (auto c = 0; c < 4; c++)
+		{
+			const auto r_s = mipp::Reg<R>(&sys[(4*k + c) * stride]);
+			for (auto p = 0; p < 4; p++)
+				(r_s + r_p[p]).store(&gamma[(4*c + p) * stride]);
+		}
+
+		const auto &alpha_prv = this->alpha[k   ];
+		      auto &alpha_nxt = this->alpha[k +1];
+		for (auto s = 0; s < this->n_states; s++)
+		{
+			mipp::Reg<R> r_a[4];
+			for (auto c = 0; c < 4; c++)
+			{
+				const auto sp = this->prev[4*s + c];
+				r_a[c] = mipp::Reg<R>(&alpha_prv[sp * stride]) + mipp::Reg<R>(&gamma[this->gam_id[4*sp + c] * stride]);
+			}
+
+			MAX(MAX(r_a[0], r_a[1]), MAX(r_a[2], r_a[3])).store(&alpha_nxt[s * stride]);
+		}
+
+		const auto r_norm = mipp::Reg<R>(&alpha_nxt[0]);
+		for (auto s = 0; s < this->n_states; s++)
+			(mipp::Reg<R>(&alpha_nxt[s * stride]) - r_norm).store(&alpha_nxt[s * stride]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::__bwd_recursion(const R *sys, const R *par, R* ext)
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	for (auto k = this->K/2 - 1; k >= 0; k--)
+	{
+		const auto &gamma    = this->gamma[k   ];
+		const auto &alpha    = this->alpha[k   ];
+		const auto &beta_nxt = this->beta [k +1];
+		      auto &beta_prv = this->beta [k   ];
+
+		mipp::Reg<R> r_post[4];
+		for (auto s = 0; s < this->n_states; s++)
+		{
+			const auto r_a = mipp::Reg<R>(&alpha[s * stride]);
+
+			mipp::Reg<R> r_b[4];
+			for (auto c = 0; c < 4; c++)
+			{
+				const auto r_bn = mipp::Reg<R>(&beta_nxt[this->next[4*s + c] * stride]);
+				const auto r_g  = mipp::Reg<R>(&gamma[this->gam_id[4*s + c] * stride]);
+
+				r_b   [c] = r_bn + r_g;
+				r_post[c] = (s == 0) ? (r_a + r_g) + r_bn : MAX(r_post[c], (r_a + r_g) + r_bn);
+			}
+
+			MAX(MAX(r_b[0], r_b[1]), MAX(r_b[2], r_b[3])).store(&beta_prv[s * stride]);
+		}
+
+		const auto r_norm = mipp::Reg<R>(&beta_prv[0]);
+		for (auto s = 0; s < this->n_states; s++)
+			(mipp::Reg<R>(&beta_prv[s * stride]) - r_norm).store(&beta_prv[s * stride]);
+
+		for (auto c = 0; c < 4; c++)
+			(r_post[c] - mipp::Reg<R>(&sys[(4*k + c) * stride])).store(&ext[(4*k + c) * stride]);
+	}
+}
+}
+}
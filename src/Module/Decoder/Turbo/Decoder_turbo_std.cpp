@@ -31,6 +31,10 @@ void Decoder_turbo_std<B,R>
 //	auto d_load = std::chrono::steady_clock::now() - t_load;
 
 //	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	// the SISO decoders must not reuse the metrics of the previous frames (next-iteration initialization)
+	this->siso_n.reset();
+	this->siso_i.reset();
+
 	const auto n_frames = this->get_simd_inter_frame_level();
 	const auto tail_n_2 = this->siso_n.tail_length() / 2;
 	const auto tail_i_2 = this->siso_i.tail_length() / 2;
@@ -17,24 +17,24 @@ Decoder_turbo_DB<B,R>
                    const Interleaver<R> &pi,
                    Decoder_RSC_DB_BCJR<B,R> &siso_n,
                    Decoder_RSC_DB_BCJR<B,R> &siso_i)
-: Decoder          (K, N, siso_n.get_n_frames(), 1),
-  Decoder_SIHO<B,R>(K, N, siso_n.get_n_frames(), 1),
+: Decoder          (K, N, siso_n.get_n_frames(), siso_n.get_simd_inter_frame_level()),
+  Decoder_SIHO<B,R>(K, N, siso_n.get_n_frames(), siso_n.get_simd_inter_frame_level()),
   n_ite            (n_ite),
   pi               (pi),
   siso_n           (siso_n),
   siso_i           (siso_i),
-  l_cpy            (2 * K),
-  l_sn             (2 * K),
-  l_si             (2 * K),
-  l_sen            (2 * K),
-  l_sei            (2 * K),
-  l_pn             (    K),
-  l_pi             (    K),
-  l_e1n            (2 * K),
-  l_e2n            (2 * K),
-  l_e1i            (2 * K),
-  l_e2i            (2 * K),
-  s                (    K)
+  l_cpy            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sn             (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_si             (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sen            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sei            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_pn             (    K * siso_n.get_simd_inter_frame_level()),
+  l_pi             (    K * siso_n.get_simd_inter_frame_level()),
+  l_e1n            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e2n            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e1i            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e2i            (2 * K * siso_n.get_simd_inter_frame_level()),
+  s                (    K * siso_n.get_simd_inter_frame_level())
 {
 	const std::string name = "Decoder_turbo_DB";
 	this->set_name(name);
@@ -85,14 +85,6 @@ Decoder_turbo_DB<B,R>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (siso_n.get_simd_inter_frame_level() != 1)
-	{
-		std::stringstream message;
-		message << "'siso_n.get_simd_inter_frame_level()' has to be equal to 1 "
-		        << "('siso_n.get_simd_inter_frame_level()' = " << siso_n.get_simd_inter_frame_level() << ").";
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-	}
-
 	if (siso_n.get_simd_inter_frame_level() != siso_i.get_simd_inter_frame_level())
 	{
 		std::stringstream message;
@@ -134,39 +126,40 @@ void Decoder_turbo_DB<B,R>
 	this->siso_n.notify_new_frame();
 	this->siso_i.notify_new_frame();
 
-	auto j = 0;
-	for (auto i = 0; i < this->K/2; i++)
+	// with the inter-frame SIMD, the LLRs of the frames are interleaved (n_frames = simd_inter_frame_level)
+	const auto n_frames = this->get_simd_inter_frame_level();
+	for (auto f = 0; f < n_frames; f++)
 	{
-		R a = tools::div2(Y_N[j++]);
-		R b = tools::div2(Y_N[j++]);
-		this->l_sn[4*i + 0] =  a + b;
-		this->l_sn[4*i + 1] =  a - b;
-		this->l_sn[4*i + 2] = -a + b;
-		this->l_sn[4*i + 3] = -a - b;
-	}
+		const auto Y_N_f = Y_N + f * this->N;
 
-	for (auto i = 0; i < this->K; i+=2)
-	{
-		this->l_pn[i] = tools::div2(Y_N[j++]);
-		this->l_pi[i] = tools::div2(Y_N[j++]);
-	}
+		auto j = 0;
+		for (auto i = 0; i < this->K/2; i++)
+		{
+			R a = tools::div2(Y_N_f[j++]);
+			R b = tools::div2(Y_N_f[j++]);
+			this->l_sn[(4*i + 0) * n_frames + f] =  a + b;
+			this->l_sn[(4*i + 1) * n_frames + f] =  a - b;
+			this->l_sn[(4*i + 2) * n_frames + f] = -a + b;
+			this->l_sn[(4*i + 3) * n_frames + f] = -a - b;
+		}
 
-	for (auto i = 1; i < this->K; i+=2)
-	{
-		this->l_pn[i] = tools::div2(Y_N[j++]);
-		this->l_pi[i] = tools::div2(Y_N[j++]);
+		for (auto i = 0; i < this->K; i+=2)
+		{
+			this->l_pn[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+			this->l_pi[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+		}
+
+		for (auto i = 1; i < this->K; i+=2)
+		{
+			this->l_pn[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+			this->l_pi[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+		}
 	}
 
 	// make the interleaving to get l_si (2 steps interleaving)
 	l_cpy = this->l_sn;
-	for (auto i = 0; i < 2 * this->K; i += 8)
-		std::swap(l_cpy[i+1], l_cpy[i+2]);
-	for (auto i = 0; i < this->K; i += 2)
-	{
-		const auto l = pi.get_core().get_lut_inv()[i >> 1];
-		for (auto bps = 0; bps < 2; bps++) this->l_si[2 * (i +0) + bps] = l_cpy[(4 * l + 0) + bps];
-		for (auto bps = 0; bps < 2; bps++) this->l_si[2 * (i +1) + bps] = l_cpy[(4 * l + 2) + bps];
-	}
+	this->_swap_couples(l_cpy.data());
+	this->_interleave_couples(l_cpy.data(), this->l_si.data());
 
 	std::fill(this->l_e1n.begin(), this->l_e1n.end(), (R)0);
 }
@@ -188,8 +181,7 @@ void Decoder_turbo_DB<B,R>
 	do
 	{
 		// sys + ext
-		for (auto i = 0; i < 2 * this->K; i++)
-			this->l_sen[i] = this->l_sn[i] + this->l_e1n[i];
+		this->_add(this->l_sn.data(), this->l_e1n.data(), this->l_sen.data());
 
 		// SISO in the natural domain
 		this->siso_n.decode_siso(this->l_sen.data(), this->l_pn.data(), this->l_e2n.data(), n_frames);
@@ -204,18 +196,11 @@ void Decoder_turbo_DB<B,R>
 		{
 			// make the interleaving
 			l_cpy = this->l_e2n;
-			for (auto i = 0; i < 2 * this->K; i += 8)
-				std::swap(l_cpy[i+1], l_cpy[i+2]);
-			for (auto i = 0; i < this->K; i += 2)
-			{
-				const auto l = pi.get_core().get_lut_inv()[i >> 1];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1i[2 * (i +0) + bps] = l_cpy[(4 * l + 0) + bps];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1i[2 * (i +1) + bps] = l_cpy[(4 * l + 2) + bps];
-			}
+			this->_swap_couples(l_cpy.data());
+			this->_interleave_couples(l_cpy.data(), this->l_e1i.data());
 
 			// sys + ext
-			for (auto i = 0; i < 2 * this->K; i++)
-				this->l_sei[i] = this->l_si[i] + this->l_e1i[i];
+			this->_add(this->l_si.data(), this->l_e1i.data(), this->l_sei.data());
 
 			// SISO in the interleaved domain
 			this->siso_i.decode_siso(this->l_sei.data(), this->l_pi.data(), this->l_e2i.data(), n_frames);
@@ -228,29 +213,24 @@ void Decoder_turbo_DB<B,R>
 
 			if (ite == this->n_ite || stop)
 				// add the systematic information to the extrinsic information, gives the a posteriori information
-				for (auto i = 0; i < 2 * this->K; i++)
-					this->l_e2i[i] += this->l_sei[i];
+				this->_add(this->l_e2i.data(), this->l_sei.data(), this->l_e2i.data());
 
 			// make the deinterleaving
-			for (auto i = 0; i < this->K; i += 2)
-			{
-				const auto l = pi.get_core().get_lut()[i >> 1];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1n[2 * (i +0) + bps] = l_e2i[(4 * l + 0) + bps];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1n[2 * (i +1) + bps] = l_e2i[(4 * l + 2) + bps];
-			}
-			for (auto i = 0; i < 2 * this->K; i += 8)
-				std::swap(this->l_e1n[i+1], this->l_e1n[i+2]);
+			this->_deinterleave_couples(this->l_e2i.data(), this->l_e1n.data());
+			this->_swap_couples(this->l_e1n.data());
 
 			// compute the hard decision only if we are in the last iteration
 			if (ite == this->n_ite || stop)
 			{
 				for (auto i = 0; i < this->K; i += 2)
-				{
-					this->s[i  ] = (std::max(this->l_e1n[2*i+2], this->l_e1n[2*i+3]) -
-					                std::max(this->l_e1n[2*i+0], this->l_e1n[2*i+1])) > 0;
-					this->s[i+1] = (std::max(this->l_e1n[2*i+1], this->l_e1n[2*i+3]) -
-					                std::max(this->l_e1n[2*i+0], this->l_e1n[2*i+2])) > 0;
-				}
+					for (auto f = 0; f < n_frames; f++)
+					{
+						const auto l_e1n_i = &this->l_e1n[2 * i * n_frames + f];
+						const R post[4] = {l_e1n_i[0], l_e1n_i[n_frames], l_e1n_i[2 * n_frames], l_e1n_i[3 * n_frames]};
+
+						this->s[(i  ) * n_frames + f] = (std::max(post[2], post[3]) - std::max(post[0], post[1])) > 0;
+						this->s[(i+1) * n_frames + f] = (std::max(post[1], post[3]) - std::max(post[0], post[2])) > 0;
+					}
 			}
 		}
 		ite++; // increment the number of iteration
@@ -274,7 +254,49 @@ template <typename B, typename R>
 void Decoder_turbo_DB<B,R>
 ::_store(B *V_K) const
 {
-	std::copy(s.data(), s.data() + this->K, V_K);
+	const auto n_frames = this->get_simd_inter_frame_level();
+	for (auto f = 0; f < n_frames; f++)
+		for (auto i = 0; i < this->K; i++)
+			V_K[f * this->K + i] = s[i * n_frames + f];
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB<B,R>
+::_add(const R *in1, const R *in2, R *out) const
+{
+	// the SIMD additions saturate in fixed-point
+	const auto n_elmts     = 2 * this->K * this->get_simd_inter_frame_level();
+	const auto vec_n_elmts = (n_elmts / mipp::nElReg<R>()) * mipp::nElReg<R>();
+
+	for (auto i = 0; i < vec_n_elmts; i += mipp::nElReg<R>())
+		(mipp::Reg<R>(&in1[i]) + mipp::Reg<R>(&in2[i])).store(&out[i]);
+	for (auto i = vec_n_elmts; i < n_elmts; i++)
+		out[i] = in1[i] + in2[i];
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB<B,R>
+::_swap_couples(R *llrs) const
+{
+	// swap the 2 bits of one couple over 2 (the LLRs of the frames are swapped together)
+	const auto n_frames = this->get_simd_inter_frame_level();
+	for (auto i = 0; i < 2 * this->K; i += 8)
+		std::swap_ranges(llrs + (i+1) * n_frames, llrs + (i+2) * n_frames, llrs + (i+2) * n_frames);
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB<B,R>
+::_interleave_couples(const R *nat, R *itl) const
+{
+	// a couple is made of 4 LLRs per frame
+	pi.get_core().permute_blocks(nat, itl, 4 * this->get_simd_inter_frame_level(), true);
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB<B,R>
+::_deinterleave_couples(const R *itl, R *nat) const
+{
+	pi.get_core().permute_blocks(itl, nat, 4 * this->get_simd_inter_frame_level(), false);
 }
 
 // ==================================================================================== explicit template instantiation
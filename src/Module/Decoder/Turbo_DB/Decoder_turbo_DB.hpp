@@ -67,6 +67,13 @@ protected:
 	virtual void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
 	virtual void _load       (const R *Y_N                            );
 	virtual void _store      (              B *V_K                    ) const;
+
+	// (de)interleave the 4 LLRs of each couple of bits, the positions are generated by the interleaver core
+	void _interleave_couples  (const R *nat, R *itl) const;
+	void _deinterleave_couples(const R *itl, R *nat) const;
+
+	void _swap_couples(R *llrs) const;
+	void _add         (const R *in1, const R *in2, R *out) const;
 };
 }
 }
@@ -11,7 +11,7 @@ using namespace aff3ct::module;
 template <typename B>
 Encoder_BCH<B>
 ::Encoder_BCH(const int& K, const int& N, const tools::BCH_polynomial_generator<B>& GF_poly, const int n_frames)
- : Encoder<B>(K, N, n_frames), n_rdncy(GF_poly.get_n_rdncy()), g(GF_poly.get_g()), bb(n_rdncy)
+ : Encoder<B>(K, N, n_frames), n_rdncy(GF_poly.get_n_rdncy()), g(GF_poly.get_g()), bb(n_rdncy), lfsr(g, n_rdncy)
 {
 	const std::string name = "Encoder_BCH";
 	this->set_name(name);
@@ -31,27 +31,7 @@ template <typename B>
 void Encoder_BCH<B>
 ::__encode(const B *U_K, B *par)
 {
-	std::fill(par, par + n_rdncy, (B)0);
-
-	for (auto i = this->K - 1; i >= 0; i--)
-	{
-		const auto feedback = U_K[i] ^ par[n_rdncy - 1];
-		if (feedback != 0)
-		{
-			for (auto j = n_rdncy - 1; j > 0; j--)
-				if (g[j] != 0)
-					par[j] = par[j - 1] ^ feedback;
-				else
-					par[j] = par[j - 1];
-			par[0] = g[0] && feedback;
-		}
-		else
-		{
-			for (auto j = n_rdncy - 1; j > 0; j--)
-				par[j] = par[j - 1];
-			par[0] = 0;
-		}
-	}
+	this->lfsr.remainder(U_K, this->K, par);
 }
 
 template <typename B>
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "Tools/Code/BCH/BCH_polynomial_generator.hpp"
+#include "Tools/Math/Galois_kernels.hpp"
 #include "Module/Encoder/Encoder.hpp"
 
 namespace aff3ct
@@ -15,9 +16,10 @@ class Encoder_BCH : public Encoder<B>
 {
 
 protected:
-	const int n_rdncy;        // number redundancy bits
-	const std::vector<B>& g;  // coefficients of the generator polynomial, g(x)
-	std::vector<B>        bb; // coefficients of redundancy polynomial x^(length-k) i(x) modulo g(x)
+	const int n_rdncy;          // number redundancy bits
+	const std::vector<B>& g;    // coefficients of the generator polynomial, g(x)
+	std::vector<B>        bb;   // coefficients of redundancy polynomial x^(length-k) i(x) modulo g(x)
+	tools::GF2_lfsr       lfsr; // bit-packed LFSR computing the division by g(x)
 
 public:
 	Encoder_BCH(const int& K, const int& N, const tools::BCH_polynomial_generator<B>& GF, const int n_frames = 1);
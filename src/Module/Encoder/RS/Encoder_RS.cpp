@@ -25,7 +25,8 @@ Encoder_RS<B>
   g           (GF.get_g()          ),
   bb          (n_rdncy             ),
   packed_U_K  (K_rs                ),
-  packed_X_N  (N_rs                )
+  packed_X_N  (N_rs                ),
+  mul_g       (n_rdncy             )
 {
 	const std::string name = "Encoder_RS";
 	this->set_name(name);
@@ -48,6 +49,9 @@ Encoder_RS<B>
 	}
 
 	std::iota(this->info_bits_pos.begin(), this->info_bits_pos.end(), n_rdncy); // redundancy on the first 'n_rdncy' bits
+
+	for (auto j = 0; j < n_rdncy; j++)
+		this->mul_g[j] = tools::Galois_linear_map<S>::mul(this->alpha_to, this->g[j]);
 }
 
 template <typename B>
@@ -58,16 +62,13 @@ void Encoder_RS<B>
 
 	for (auto i = this->K_rs - 1; i >= 0; i--)
 	{
-		const auto feedback = this->index_of[U_K[i] ^ par[this->n_rdncy - 1]];
+		const auto feedback = (S)(U_K[i] ^ par[this->n_rdncy - 1]);
 
-		if (feedback != -1)
+		if (feedback != 0)
 		{
 			for (auto j = this->n_rdncy - 1; j > 0; j--)
-				if (this->g[j] != -1)
-					par[j] = par[j - 1] ^ this->alpha_to[(this->g[j] + feedback) % this->N_rs];
-				else
-					par[j] = par[j - 1];
-			par[0] = this->alpha_to[(this->g[0] + feedback) % this->N_rs];
+				par[j] = par[j - 1] ^ this->mul_g[j].apply(feedback);
+			par[0] = this->mul_g[0].apply(feedback);
 		}
 		else
 		{
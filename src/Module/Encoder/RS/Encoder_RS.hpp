@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "Tools/Code/RS/RS_polynomial_generator.hpp"
+#include "Tools/Math/Galois_kernels.hpp"
 #include "Module/Encoder/Encoder.hpp"
 
 /* source : http://www.eccpage.com/  */
@@ -28,6 +29,7 @@ protected:
 	std::vector<S>          bb;           // coefficients of redundancy polynomial x^(length-k) i(x) modulo g(x)
 	std::vector<S>          packed_U_K;   // the source bits packed as GF(m) symbols
 	std::vector<S>          packed_X_N;   // the encoded bits packed as GF(m) symbols
+	std::vector<tools::Galois_linear_map<S>> mul_g; // multiplications by the coefficients of g(x)
 
 public:
 	// K and N are the RS size in symbols: K_rs and N_rs. K and N in bits are deduced as K = K_rs * m and N = N_rs * M
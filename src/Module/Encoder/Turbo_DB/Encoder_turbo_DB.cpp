@@ -75,12 +75,7 @@ void Encoder_turbo_DB<B>
 	for (auto i = 0; i < this->K; i+=4)
 		std::swap(U_K_cpy[frame_id * this->K +i], U_K_cpy[frame_id * this->K + i +1]);
 
-	for (auto i = 0; i < this->K; i += 2)
-	{
-		const auto l = pi.get_core().get_lut_inv()[i >> 1];
-		U_K_i[frame_id * this->K + i +0] = U_K_cpy[frame_id * this->K + l * 2 +0];
-		U_K_i[frame_id * this->K + i +1] = U_K_cpy[frame_id * this->K + l * 2 +1];
-	}
+	this->_interleave_couples(U_K_cpy.data() + frame_id * this->K, U_K_i.data() + frame_id * this->K);
 
 	enco_n.encode(U_K - frame_id * enco_n.get_K(), X_N_tmp.data(), frame_id);
 
@@ -130,12 +125,7 @@ bool Encoder_turbo_DB<B>
 	for (auto i = 0; i < this->K; i += 4)
 		std::swap(U_K_n[i], U_K_n[i+1]);
 
-	for (auto i = 0; i < this->K; i += 2)
-	{
-		const auto l = pi.get_core().get_lut_inv()[i >> 1];
-		U_K_i[i +0] = U_K_n[l * 2 +0];
-		U_K_i[i +1] = U_K_n[l * 2 +1];
-	}
+	this->_interleave_couples(U_K_n.data(), U_K_i.data());
 	std::copy(U_K_i.begin(), U_K_i.begin() + this->K, X_N_tmp.begin());
 
 	auto *X_N_par_i = X_N_tmp.data() + this->K;
@@ -151,6 +141,13 @@ bool Encoder_turbo_DB<B>
 	return true;
 }
 
+template <typename B>
+void Encoder_turbo_DB<B>
+::_interleave_couples(const B *nat, B *itl) const
+{
+	pi.get_core().permute_blocks(nat, itl, 2, true);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
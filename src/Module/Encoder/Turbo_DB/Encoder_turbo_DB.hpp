@@ -35,6 +35,9 @@ public:
 
 protected:
 	void _encode(const B *U_K, B *X_N, const int frame_id);
+
+	// interleave the couples of bits, the positions are generated by the interleaver core
+	void _interleave_couples(const B *nat, B *itl) const;
 };
 }
 }
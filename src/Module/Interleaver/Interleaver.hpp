@@ -63,6 +63,14 @@ private:
 	                        const bool frame_reordering,
 	                        const int  n_frames,
 	                        const int  frame_id) const;
+
+	inline void _interleave_gen(const D *in_vec, D *out_vec,
+	                            const bool inverse,
+	                            const bool frame_reordering,
+	                            const int  n_frames,
+	                            const int  frame_id) const;
+
+	static inline void _gather(const D *in_vec, D *out_vec, const T *lookup_table, const int size);
 };
 }
 }
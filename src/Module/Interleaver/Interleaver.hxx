@@ -1,6 +1,10 @@
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <mipp.h>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
 
 #include "Tools/Exception/exception.hpp"
 #include "Module/Interleaver/Interleaver.hpp"
@@ -103,7 +107,10 @@ void Interleaver<D,T>::
 interleave(const D *nat, D *itl, const int frame_id, const int n_frames,
                        const bool frame_reordering) const
 {
-	this->_interleave(nat, itl, core.get_lut(), frame_reordering, n_frames, frame_id);
+	if (core.is_lut_free())
+		this->_interleave_gen(nat, itl, false, frame_reordering, n_frames, frame_id);
+	else
+		this->_interleave(nat, itl, core.get_lut(), frame_reordering, n_frames, frame_id);
 }
 
 template <typename D, typename T>
@@ -157,7 +164,10 @@ void Interleaver<D,T>::
 deinterleave(const D *itl, D *nat, const int frame_id, const int n_frames,
                          const bool frame_reordering) const
 {
-	this->_interleave(itl, nat, core.get_lut_inv(), frame_reordering, n_frames, frame_id);
+	if (core.is_lut_free())
+		this->_interleave_gen(itl, nat, true, frame_reordering, n_frames, frame_id);
+	else
+		this->_interleave(itl, nat, core.get_lut_inv(), frame_reordering, n_frames, frame_id);
 }
 
 template <typename D, typename T>
@@ -198,13 +208,20 @@ _interleave(const D *in_vec, D *out_vec,
 		}
 		else
 		{
-			auto cur_frame_id = frame_id % this->n_frames;
-			for (auto f = 0; f < n_frames; f++)
+			// cache-blocked permutation: the output lines of a block stay in the cache while the frames are processed
+			const auto size = this->core.get_size();
+			const auto blk  = std::max(1, (int)(16384 / (n_frames * sizeof(D))));
+			for (auto i0 = 0; i0 < size; i0 += blk)
 			{
-				const auto lut = lookup_table.data() + cur_frame_id * this->core.get_size();
-				for (auto i = 0; i < this->core.get_size(); i++)
-					out_vec[i * n_frames +f] = in_vec[lut[i] * n_frames +f];
-				cur_frame_id = (cur_frame_id +1) % this->n_frames;
+				const auto i1 = std::min(size, i0 + blk);
+				auto cur_frame_id = frame_id % this->n_frames;
+				for (auto f = 0; f < n_frames; f++)
+				{
+					const auto lut = lookup_table.data() + cur_frame_id * size;
+					for (auto i = i0; i < i1; i++)
+						out_vec[i * n_frames +f] = in_vec[lut[i] * n_frames +f];
+					cur_frame_id = (cur_frame_id +1) % this->n_frames;
+				}
 			}
 		}
 	}
@@ -212,29 +229,135 @@ _interleave(const D *in_vec, D *out_vec,
 	{
 		if (!this->core.is_uniform())
 		{
-			// TODO: vectorize this code with the new AVX gather instruction
 			for (auto f = 0; f < n_frames; f++)
 			{
 				const auto off = f * this->core.get_size();
-				for (auto i = 0; i < this->core.get_size(); i++)
-					out_vec[off + i] = in_vec[off + lookup_table[i]];
+				_gather(in_vec + off, out_vec + off, lookup_table.data(), this->core.get_size());
 			}
 		}
 		else
 		{
 			auto cur_frame_id = frame_id % this->n_frames;
-			// TODO: vectorize this code with the new AVX gather instruction
 			for (auto f = 0; f < n_frames; f++)
 			{
 				const auto lut = lookup_table.data() + cur_frame_id * this->core.get_size();
 				const auto off = f * this->core.get_size();
-				for (auto i = 0; i < this->core.get_size(); i++)
-					out_vec[off + i] = in_vec[off + lut[i]];
+				_gather(in_vec + off, out_vec + off, lut, this->core.get_size());
 				cur_frame_id = (cur_frame_id +1) % this->n_frames;
 			}
 		}
 	}
 }
 
+template <typename D, typename T>
+void Interleaver<D,T>::
+_interleave_gen(const D *in_vec, D *out_vec,
+                const bool inverse,
+                const bool frame_reordering,
+                const int  n_frames,
+                const int  frame_id) const
+{
+	if (!core.is_initialized())
+	{
+		std::string message = "'init' method has to be called first, before trying to (de)interleave something.";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message);
+	}
+
+	// the interleaving positions are generated by small blocks which stay in the L1 cache, they are shared by all the
+	// frames (the LUT-free interleavers are not uniform); the deinterleaving scatters with the same positions
+	constexpr int blk = 256;
+	T idx[blk];
+
+	const auto size = this->core.get_size();
+	for (auto i0 = 0; i0 < size; i0 += blk)
+	{
+		const auto n = std::min(blk, size - i0);
+		this->core.gen_idx(idx, i0, n, frame_id < 0 ? 0 : frame_id);
+
+		if (frame_reordering)
+		{
+			// vectorized interleaving
+			if (n_frames == mipp::nElReg<D>())
+			{
+				for (auto i = 0; i < n; i++)
+				{
+					const auto off_nat = (i0 + i) * mipp::nElReg<D>();
+					const auto off_itl = (int)idx[i] * mipp::nElReg<D>();
+					if (inverse)
+						mipp::store<D>(&out_vec[off_itl], mipp::load<D>(&in_vec[off_nat]));
+					else
+						mipp::store<D>(&out_vec[off_nat], mipp::load<D>(&in_vec[off_itl]));
+				}
+			}
+			else
+			{
+				for (auto i = 0; i < n; i++)
+				{
+					const auto off_nat = (i0 + i) * n_frames;
+					const auto off_itl = (int)idx[i] * n_frames;
+					if (inverse)
+						for (auto f = 0; f < n_frames; f++)
+							out_vec[off_itl +f] = in_vec[off_nat +f];
+					else
+						for (auto f = 0; f < n_frames; f++)
+							out_vec[off_nat +f] = in_vec[off_itl +f];
+				}
+			}
+		}
+		else
+		{
+			for (auto f = 0; f < n_frames; f++)
+			{
+				const auto off = f * size;
+				if (inverse)
+					for (auto i = 0; i < n; i++)
+						out_vec[off + idx[i]] = in_vec[off + i0 + i];
+				else
+					_gather(in_vec + off, out_vec + off + i0, idx, n);
+			}
+		}
+	}
+}
+
+template <typename D, typename T>
+void Interleaver<D,T>::
+_gather(const D *in_vec, D *out_vec, const T *lookup_table, const int size)
+{
+	auto i = 0;
+
+	// MIPP does not expose the gather instructions: the intrinsics are directly used for the 32-bit and 64-bit data
+#if defined(__AVX512F__)
+	if (sizeof(D) == 4 && sizeof(T) == 4)
+		for (; i <= size - 16; i += 16)
+		{
+			const auto idx = _mm512_loadu_si512((const void*)(lookup_table + i));
+			_mm512_storeu_si512((void*)(out_vec + i), _mm512_i32gather_epi32(idx, (const void*)in_vec, 4));
+		}
+	else if (sizeof(D) == 8 && sizeof(T) == 4)
+		for (; i <= size - 8; i += 8)
+		{
+			const auto idx = _mm256_loadu_si256((const __m256i*)(lookup_table + i));
+			_mm512_storeu_si512((void*)(out_vec + i), _mm512_i32gather_epi64(idx, (const void*)in_vec, 8));
+		}
+#elif defined(__AVX2__)
+	if (sizeof(D) == 4 && sizeof(T) == 4)
+		for (; i <= size - 8; i += 8)
+		{
+			const auto idx = _mm256_loadu_si256((const __m256i*)(lookup_table + i));
+			_mm256_storeu_si256((__m256i*)(out_vec + i), _mm256_i32gather_epi32((const int*)in_vec, idx, 4));
+		}
+	else if (sizeof(D) == 8 && sizeof(T) == 4)
+		for (; i <= size - 4; i += 4)
+		{
+			const auto idx = _mm_loadu_si128((const __m128i*)(lookup_table + i));
+			_mm256_storeu_si256((__m256i*)(out_vec + i),
+			                    _mm256_i32gather_epi64((const long long*)in_vec, idx, 8));
+		}
+#endif
+
+	for (; i < size; i++)
+		out_vec[i] = in_vec[lookup_table[i]];
+}
+
 }
 }
@@ -14,7 +14,7 @@ Monitor_BFER<B>
 ::Monitor_BFER(const int K, const unsigned max_fe, const unsigned max_n_frames,
                const bool count_unknown_values, const int n_frames)
 : Monitor(n_frames), K(K), max_fe(max_fe), max_n_frames(max_n_frames),
-  count_unknown_values(count_unknown_values), err_hist(0), err_hist_activated(false)
+  count_unknown_values(count_unknown_values), err_hist(), err_hist_activated(false)
 {
 	const std::string name = "Monitor_BFER";
 	this->set_name(name);
@@ -259,7 +259,7 @@ bool Monitor_BFER<B>
 }
 
 template<typename B>
-tools::Histogram<int> Monitor_BFER<B>::get_err_hist() const
+const tools::Histogram_dense& Monitor_BFER<B>::get_err_hist() const
 {
 	return err_hist;
 }
@@ -269,6 +269,10 @@ void Monitor_BFER<B>
 ::activate_err_histogram(bool val)
 {
 	err_hist_activated = val;
+
+	// there can't be more than K bit errors in a frame
+	if (err_hist_activated)
+		err_hist.resize(get_K() +1);
 }
 
 
@@ -343,6 +347,25 @@ void Monitor_BFER<B>
 	vals += v;
 }
 
+template <typename B>
+void Monitor_BFER<B>
+::collect(const unsigned long long n_fra, const unsigned long long n_be, const unsigned long long n_fe)
+{
+	Attributes v;
+	v.n_fra = n_fra;
+	v.n_be  = n_be;
+	v.n_fe  = n_fe;
+
+	collect(v);
+}
+
+template <typename B>
+void Monitor_BFER<B>
+::collect(const tools::Histogram_dense& err_hist)
+{
+	this->err_hist.add_values(err_hist);
+}
+
 template <typename B>
 Monitor_BFER<B>& Monitor_BFER<B>
 ::operator+=(const Monitor_BFER<B>& m)
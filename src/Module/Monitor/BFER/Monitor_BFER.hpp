@@ -5,7 +5,7 @@
 #include <memory>
 #include <functional>
 
-#include "Tools/Algo/Histogram.hpp"
+#include "Tools/Algo/Histogram_dense.hpp"
 #include "Module/Monitor/Monitor.hpp"
 
 namespace aff3ct
@@ -39,7 +39,7 @@ private:
 	const bool     count_unknown_values; // take into account or not the unknown values as wrong values in the checked frames
 
 	Attributes vals;
-	tools::Histogram<int> err_hist; // the error histogram record
+	tools::Histogram_dense err_hist; // the error histogram record (allocated when activated)
 	bool err_hist_activated;
 
 	std::vector<std::function<void(unsigned, int )>> callbacks_fe;
@@ -84,7 +84,7 @@ public:
 	float                 get_fer                 () const;
 	float                 get_ber                 () const;
 
-	tools::Histogram<int> get_err_hist            () const;
+	const tools::Histogram_dense& get_err_hist    () const;
 	void activate_err_histogram(bool val);
 
 	virtual void add_handler_fe               (std::function<void(unsigned, int )> callback);
@@ -97,6 +97,8 @@ public:
 	virtual void collect(const Monitor& m,         bool fully = false);
 	virtual void collect(const Monitor_BFER<B>& m, bool fully = false);
 	virtual void collect(const Attributes& v);
+	virtual void collect(const tools::Histogram_dense& err_hist);
+	virtual void collect(const unsigned long long n_fra, const unsigned long long n_be, const unsigned long long n_fe);
 
 	Monitor_BFER<B>& operator+=(const Monitor_BFER<B>& m); // not full "collect" call
 
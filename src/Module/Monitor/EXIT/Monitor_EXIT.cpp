@@ -1,4 +1,5 @@
 #include <cmath>
+#include <algorithm>
 #include <string>
 #include <limits>
 #include <vector>
@@ -113,14 +114,27 @@ void Monitor_EXIT<B,R>
 	}
 }
 
+template <typename B, typename R>
+template <class F>
+void Monitor_EXIT<B,R>
+::for_each_bit_llr(F f) const
+{
+	for (auto m : this->buffs)
+		for (size_t i = 0; i < m->bits_buff.size(); i++)
+			f(m->bits_buff[i], m->llrs_e_buff[i]);
+}
+
 template <typename B, typename R>
 R Monitor_EXIT<B,R>
 ::_check_mutual_info_histo() const
 {
-	size_t N = this->bits_buff.size();
+	size_t N = 0;
 	unsigned bit_1_count = 0;
-	for (size_t i = 0; i < N; i++)
-		bit_1_count += (unsigned)bits_buff[i];
+	for_each_bit_llr([&](const B bit, const R)
+	{
+		N++;
+		bit_1_count += (unsigned)bit;
+	});
 
 	unsigned bit_0_count = (unsigned)N - bit_1_count;
 	if (bit_0_count == 0 || bit_1_count == 0)
@@ -143,49 +157,49 @@ R Monitor_EXIT<B,R>
 		unsigned llr_0_noninfinite_count = 0;
 		unsigned llr_1_noninfinite_count = 0;
 
-		for (unsigned i = 0; i < N; i++)
+		for_each_bit_llr([&](const B bit, const R llr_e)
 		{
-			if (!std::isinf(llrs_e_buff[i]))
+			if (!std::isinf(llr_e))
 			{
-				if ((int)bits_buff[i] == 0)
+				if ((int)bit == 0)
 				{
 					llr_0_noninfinite_count++;
-					llr_0_min = std::min(llrs_e_buff[i], llr_0_min);
-					llr_0_max = std::max(llrs_e_buff[i], llr_0_max);
+					llr_0_min = std::min(llr_e, llr_0_min);
+					llr_0_max = std::max(llr_e, llr_0_max);
 				}
 				else
 				{
 					llr_1_noninfinite_count++;
-					llr_1_min = std::min(llrs_e_buff[i], llr_1_min);
-					llr_1_max = std::max(llrs_e_buff[i], llr_1_max);
+					llr_1_min = std::min(llr_e, llr_1_min);
+					llr_1_max = std::max(llr_e, llr_1_max);
 				}
 			}
-		}
+		});
 		if (llr_0_noninfinite_count && llr_1_noninfinite_count && llr_0_min <= llr_1_max && llr_1_min <= llr_0_max)
 		{
 			R llr_0_mean = (R)0;
 			R llr_1_mean = (R)0;
-			for (unsigned i = 0; i < N; i++)
+			for_each_bit_llr([&](const B bit, const R llr_e)
 			{
-				if (!std::isinf(llrs_e_buff[i]))
+				if (!std::isinf(llr_e))
 				{
-					if ((int)bits_buff[i] == 0) llr_0_mean += llrs_e_buff[i];
-					else                        llr_1_mean += llrs_e_buff[i];
+					if ((int)bit == 0) llr_0_mean += llr_e;
+					else               llr_1_mean += llr_e;
 				}
-			}
+			});
 			llr_0_mean /= llr_0_noninfinite_count;
 			llr_1_mean /= llr_1_noninfinite_count;
 
 			R llr_0_variance = (R)0;
 			R llr_1_variance = (R)0;
-			for (unsigned i = 0; i < N; i++)
+			for_each_bit_llr([&](const B bit, const R llr_e)
 			{
-				if (!std::isinf(llrs_e_buff[i]))
+				if (!std::isinf(llr_e))
 				{
-					if ((int)bits_buff[i] == 0) llr_0_variance += std::pow((llrs_e_buff[i] - llr_0_mean), 2);
-					else                        llr_1_variance += std::pow((llrs_e_buff[i] - llr_1_mean), 2);
+					if ((int)bit == 0) llr_0_variance += std::pow((llr_e - llr_0_mean), 2);
+					else               llr_1_variance += std::pow((llr_e - llr_1_mean), 2);
 				}
-			}
+			});
 			llr_0_variance /= llr_0_noninfinite_count;
 			llr_1_variance /= llr_1_noninfinite_count;
 
@@ -214,23 +228,23 @@ R Monitor_EXIT<B,R>
 
 		std::vector<std::vector<unsigned>> histogram(2, std::vector<unsigned>(bin_count));
 		std::vector<std::vector<R       >> pdf      (2, std::vector<R       >(bin_count));
-		for (unsigned i = 0; i < N; i++)
+		for_each_bit_llr([&](const B bit, const R llr_e)
 		{
-			if      (llrs_e_buff[i] == -inf) histogram[(int)bits_buff[i]][0           ]++;
-			else if (llrs_e_buff[i] ==  inf) histogram[(int)bits_buff[i]][bin_count -1]++;
+			if      (llr_e == -inf) histogram[(int)bit][0           ]++;
+			else if (llr_e ==  inf) histogram[(int)bit][bin_count -1]++;
 			else
 			{
 				if (lots_of_bins)
 				{
 					if (bin_width > 0.0)
-						histogram[(int)bits_buff[i]][(int)(std::floor(llrs_e_buff[i] / bin_width) - bin_offset)]++;
+						histogram[(int)bit][(int)(std::floor(llr_e / bin_width) - bin_offset)]++;
 					else
-						histogram[(int)bits_buff[i]][1]++;
+						histogram[(int)bit][1]++;
 				}
 				else
-					histogram[(int)bits_buff[i]][(int)bits_buff[i] +1]++;
+					histogram[(int)bit][(int)bit +1]++;
 			}
-		}
+		});
 
 		for (unsigned i = 0; i < bin_count; i++)
 		{
@@ -324,6 +338,8 @@ void Monitor_EXIT<B,R>
 
 	bits_buff  .clear();
 	llrs_e_buff.clear();
+
+	buffs.assign(1, this);
 }
 
 template <typename B, typename R>
@@ -347,6 +363,11 @@ void Monitor_EXIT<B,R>
 	equivalent(m, true);
 
 	collect(m.get_attributes());
+
+	if (fully)
+		for (auto b : m.buffs)
+			if (std::find(buffs.begin(), buffs.end(), b) == buffs.end())
+				buffs.push_back(b);
 }
 
 template <typename B, typename R>
@@ -378,6 +399,18 @@ void Monitor_EXIT<B,R>
 	equivalent(m, true);
 
 	copy(m.get_attributes());
+
+	if (fully)
+	{
+		// the own buffers of 'm' are copied, the ones it references are only referenced
+		bits_buff   = m.bits_buff;
+		llrs_e_buff = m.llrs_e_buff;
+
+		buffs.assign(1, this);
+		for (auto b : m.buffs)
+			if (b != &m && b != this)
+				buffs.push_back(b);
+	}
 }
 
 template <typename B, typename R>
@@ -40,6 +40,10 @@ private:
 	std::vector<B> bits_buff;
 	std::vector<R> llrs_e_buff;
 
+	// the monitors whose 'bits_buff' and 'llrs_e_buff' are used to estimate I_E (this one included): a full reduction
+	// only references the buffers of the collected monitors instead of copying them, so those have to outlive it
+	std::vector<const Monitor_EXIT<B,R>*> buffs;
+
 public:
 	Monitor_EXIT(const int size, const unsigned max_n_trials, const int n_frames = 1);
 	Monitor_EXIT(const Monitor_EXIT<B,R>& m, const int n_frames = -1); // construct with the same parameters than "m"
@@ -96,6 +100,10 @@ public:
 protected:
 	virtual void _check_mutual_info_avg  (const B *bits, const R *llrs_a, const int frame_id);
 	virtual R _check_mutual_info_histo() const;
+
+private:
+	template <class F>
+	void for_each_bit_llr(F f) const;
 };
 }
 }
@@ -296,6 +296,26 @@ void Monitor_MI<B,R>
 	vals += v;
 }
 
+template <typename B, typename R>
+void Monitor_MI<B,R>
+::collect(const unsigned long long n_trials, const R MI, const R MI_max, const R MI_min)
+{
+	Attributes v;
+	v.n_trials = n_trials;
+	v.MI       = MI;
+	v.MI_max   = MI_max;
+	v.MI_min   = MI_min;
+
+	collect(v);
+}
+
+template <typename B, typename R>
+void Monitor_MI<B,R>
+::collect(const tools::Histogram<R>& mutinfo_hist)
+{
+	this->mutinfo_hist.add_values(mutinfo_hist);
+}
+
 template <typename B, typename R>
 Monitor_MI<B,R>& Monitor_MI<B,R>
 ::operator+=(const Monitor_MI<B,R>& m)
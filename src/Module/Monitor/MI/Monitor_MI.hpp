@@ -86,6 +86,8 @@ public:
 	virtual void collect(const Monitor& m,         bool fully = false);
 	virtual void collect(const Monitor_MI<B,R>& m, bool fully = false);
 	virtual void collect(const Attributes& v);
+	virtual void collect(const tools::Histogram<R>& mutinfo_hist);
+	virtual void collect(const unsigned long long n_trials, const R MI, const R MI_max, const R MI_min);
 
 	Monitor_MI<B,R>& operator+=(const Monitor_MI<B,R>& m); // "collect" call with fully = false
 
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 #ifdef AFF3CT_MPI
@@ -16,24 +17,52 @@ std::thread::id                                                              aff
 std::chrono::nanoseconds                                                     aff3ct::module::Monitor_reduction::d_reduce_frequency = std::chrono::milliseconds(1000);
 std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> aff3ct::module::Monitor_reduction::t_last_reduction;
 
+#ifdef AFF3CT_MPI
+namespace
+{
+MPI_Comm    MPI_comm_stop  = MPI_COMM_NULL;     // communicator dedicated to the stop criterion reductions
+MPI_Request MPI_req_stop   = MPI_REQUEST_NULL;  // request of the current non-blocking round
+int         stop_send      = 0;
+int         n_stop_recv    = 0;
+bool        round_pending  = false;             // a round has been started and is not completed yet
+}
+#endif
+
 Monitor_reduction
 ::Monitor_reduction()
 {
 	Monitor_reduction::add_monitor(this);
 }
 
+Monitor_reduction
+::~Monitor_reduction()
+{
+	Monitor_reduction::remove_monitor(this);
+}
+
 void Monitor_reduction
 ::add_monitor(Monitor_reduction* m)
 {
 	Monitor_reduction::monitors.push_back(m);
 }
 
+void Monitor_reduction
+::remove_monitor(Monitor_reduction* m)
+{
+	auto &mnts = Monitor_reduction::monitors;
+	mnts.erase(std::remove(mnts.begin(), mnts.end(), m), mnts.end());
+}
+
 void Monitor_reduction
 ::reset_all()
 {
 	Monitor_reduction::t_last_reduction = std::chrono::steady_clock::now();
 	Monitor_reduction::stop_loop        = false;
 
+#ifdef AFF3CT_MPI
+	n_stop_recv = 0;
+#endif
+
 	for(auto& m : Monitor_reduction::monitors)
 		m->reset_mr();
 }
@@ -69,6 +98,10 @@ void Monitor_reduction
 	Monitor_reduction::set_stop_loop();
 
 	while(!__reduce__(fully, true));
+
+	if (fully)
+		for (auto& m : Monitor_reduction::monitors)
+			m->_reduce_fully();
 }
 
 void Monitor_reduction
@@ -93,21 +126,78 @@ void Monitor_reduction
 		        << ", and 'pow_np' = " << pow_np << ").";
 		throw tools::logic_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	if (MPI_comm_stop == MPI_COMM_NULL)
+		if (auto ret = MPI_Comm_dup(MPI_COMM_WORLD, &MPI_comm_stop))
+		{
+			std::stringstream message;
+			message << "'MPI_Comm_dup' returned '" << ret << "' error code.";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
 #endif
 }
 
 bool Monitor_reduction
-::reduce_stop_loop()
+::complete_reduce_stop_loop(bool wait)
 {
 #ifdef AFF3CT_MPI
-	int n_stop_recv, stop_send = Monitor_reduction::get_stop_loop() ? 1 : 0;
-	MPI_Allreduce(&stop_send, &n_stop_recv, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+	int completed = 1;
+	if (wait)
+		MPI_Wait(&MPI_req_stop, MPI_STATUS_IGNORE);
+	else
+		MPI_Test(&MPI_req_stop, &completed, MPI_STATUS_IGNORE);
+
+	for (auto& m : Monitor_reduction::monitors)
+		completed &= m->_complete_reduction(wait) ? 1 : 0;
+
+	if (!completed)
+		return false;
+
+	round_pending = false;
 
 	if (n_stop_recv > 0)
 		Monitor_reduction::set_stop_loop();
+#endif
 
+	return true;
+}
+
+bool Monitor_reduction
+::reduce_stop_loop(bool force)
+{
+#ifdef AFF3CT_MPI
 	int np;
-	MPI_Comm_size(MPI_COMM_WORLD, &np);
+	MPI_Comm_size(MPI_comm_stop, &np);
+
+	// complete the previous round before starting a new one
+	if (round_pending)
+	{
+		if (!Monitor_reduction::complete_reduce_stop_loop(force))
+			return false;
+
+		if (n_stop_recv == np)
+			return true;
+	}
+
+	// only the processes in the final reduce step report themselves, the others will join them after having seen
+	// that a process has stopped
+	stop_send = (force && Monitor_reduction::get_stop_loop()) ? 1 : 0;
+
+	for (auto& m : Monitor_reduction::monitors)
+		m->_start_reduction();
+
+	if (auto ret = MPI_Iallreduce(&stop_send, &n_stop_recv, 1, MPI_INT, MPI_SUM, MPI_comm_stop, &MPI_req_stop))
+	{
+		std::stringstream message;
+		message << "'MPI_Iallreduce' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+	round_pending = true;
+
+	if (!force)
+		return false;
+
+	Monitor_reduction::complete_reduce_stop_loop(true);
 
 	return n_stop_recv == np;
 #else
@@ -128,7 +218,7 @@ bool Monitor_reduction
 		for (auto& m : Monitor_reduction::monitors)
 			m->_reduce(fully);
 
-		all_process_on_last = reduce_stop_loop();
+		all_process_on_last = reduce_stop_loop(force);
 
 		Monitor_reduction::t_last_reduction = std::chrono::steady_clock::now();
 	}
@@ -158,4 +248,20 @@ void Monitor_reduction
 ::set_stop_loop()
 {
 	Monitor_reduction::stop_loop = true;
+}
+
+void Monitor_reduction
+::_start_reduction()
+{
+}
+
+bool Monitor_reduction
+::_complete_reduction(bool wait)
+{
+	return true;
+}
+
+void Monitor_reduction
+::_reduce_fully()
+{
 }
\ No newline at end of file
@@ -41,6 +41,7 @@ public:
 
 	/*
 	 * \brief loop on a forced reduction until '__reduce__' call return 'true' after having call 'set_stop_loop()'
+	 *        then, if 'fully' is set, call '_reduce_fully()' on each monitor (all the processes at the same time)
 	 */
 	static void last_reduce_all(bool fully = false);
 
@@ -72,13 +73,34 @@ public:
 protected:
 	Monitor_reduction();
 
-	virtual ~Monitor_reduction() = default;
+	/*
+	 * \brief remove the monitor from the 'monitors' list
+	 */
+	virtual ~Monitor_reduction();
 
 	/*
 	 * \brief do the reduction of this monitor
 	 */
 	virtual void _reduce(bool fully = false) = 0;
 
+	/*
+	 * \brief start a non-blocking reduction of this monitor between the processes (nothing to do without MPI)
+	 */
+	virtual void _start_reduction();
+
+	/*
+	 * \brief complete the non-blocking reduction started by '_start_reduction()' and apply its result
+	 * \param wait if set, block until the reduction is completed, else only test it
+	 * \return true if the reduction is completed
+	 */
+	virtual bool _complete_reduction(bool wait);
+
+	/*
+	 * \brief do a blocking full reduction (with the histograms) of this monitor between the processes, called by
+	 *        all the processes at the same time after the last reduction
+	 */
+	virtual void _reduce_fully();
+
 	/*
 	 * \brief reset this monitor
 	 */
@@ -96,18 +118,34 @@ private:
 	 */
 	static void add_monitor(Monitor_reduction*);
 
+	/*
+	 * \brief remove the monitor from the 'monitors' list
+	 */
+	static void remove_monitor(Monitor_reduction*);
+
 	/*
 	 * \brief do a reduction of the number of process that are at the final reduce step
+	 *        with MPI, the reduction is a non-blocking round started with the monitors reductions: a round is
+	 *        completed by one of the next calls before a new one is started, so all the processes stay in lockstep
+	 * \param force if set, wait for the completion of the round, else only test it
 	 * \return true if all process are at the final reduce step (always true without MPI)
 	 */
-	static bool reduce_stop_loop();
+	static bool reduce_stop_loop(bool force);
+
+	/*
+	 * \brief complete the current round of 'reduce_stop_loop()' and of the monitors reductions
+	 * \param wait if set, block until the round is completed, else only test it
+	 * \return true if the round is completed (always true without MPI)
+	 */
+	static bool complete_reduce_stop_loop(bool wait);
 
 	/*
 	 * \brief do the reductions of all 'monitors' if the thread calling it is the master thread and if the
 	 *        'd_reduce_frequency' criteria is reached.
 	 * \param force if set, do the reduction anyway
 	 * \param fully if set, do a full reduction of all attributes
-	 * \return the result of the 'reduce_stop_loop()' call after the reductions. If there were not, then return false.
+	 * \return the result of the 'reduce_stop_loop(force)' call after the reductions. If there were not, then return
+	 *         false.
 	 */
 	static bool __reduce__(bool fully, bool force);
 };
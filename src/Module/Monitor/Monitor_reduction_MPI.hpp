@@ -7,6 +7,10 @@
 #include <memory>
 #include <mpi.h>
 
+#include "Tools/Algo/Histogram.hpp"
+#include "Tools/Algo/Histogram_dense.hpp"
+#include "Module/Monitor/BFER/Monitor_BFER.hpp"
+#include "Module/Monitor/MI/Monitor_MI.hpp"
 #include "Module/Monitor/Monitor_reduction.hpp"
 
 namespace aff3ct
@@ -22,18 +26,41 @@ protected:
 private:
 	MPI_Datatype MPI_monitor_vals;
 	MPI_Op       MPI_Op_reduce_monitors;
+	MPI_Comm     MPI_comm_monitors;              // communicator dedicated to the reductions of this monitor
+	MPI_Request  MPI_req_monitors;               // request of the current non-blocking reduction
+
+	Attributes   mvals_local;                    // attributes of the local threads
+	Attributes   mvals_send;                     // attributes sent in the current non-blocking reduction
+	Attributes   mvals_recv;                     // attributes received by the current non-blocking reduction
+	Attributes   mvals_glob;                     // attributes of all the processes at the last completed reduction
+	bool         is_glob;                        // true if 'mvals_glob' is valid
 
 public:
 	explicit Monitor_reduction_MPI(const std::vector<std::unique_ptr<M>> &monitors);
-	virtual ~Monitor_reduction_MPI() = default;
+	virtual ~Monitor_reduction_MPI();
 
 	virtual void reset();
 
 protected:
 	virtual void _reduce(bool fully = false);
 
+	virtual void _start_reduction();
+	virtual bool _complete_reduction(bool wait);
+	virtual void _reduce_fully();
+
 private:
 	static void MPI_reduce_monitors(void *in, void *inout, int *len, MPI_Datatype *datatype);
+
+	template <typename H>
+	void reduce_histogram(const tools::Histogram<H>& hist);
+
+	void reduce_histogram(const tools::Histogram_dense& hist);
+
+	template <typename B>
+	void reduce_histograms(Monitor_BFER<B>& m);
+
+	template <typename B, typename R>
+	void reduce_histograms(Monitor_MI<B,R>& m);
 };
 }
 }
@@ -3,6 +3,8 @@
 #ifndef MONITOR_REDUCTION_MPI_HXX_
 #define MONITOR_REDUCTION_MPI_HXX_
 
+#include <algorithm>
+#include <vector>
 #include <sstream>
 
 #include "Tools/Exception/exception.hpp"
@@ -16,7 +18,9 @@ namespace module
 template <class M>
 Monitor_reduction_MPI<M>
 ::Monitor_reduction_MPI(const std::vector<std::unique_ptr<M>> &monitors)
-: Monitor_reduction_M<M>(monitors)
+: Monitor_reduction_M<M>(monitors),
+  MPI_req_monitors(MPI_REQUEST_NULL),
+  is_glob(false)
 {
 	const std::string name = "Monitor_reduction_MPI<" + monitors[0]->get_name() + ">";
 	this->set_name(name);
@@ -45,20 +49,200 @@ Monitor_reduction_MPI<M>
 		message << "'MPI_Op_create' returned '" << ret << "' error code.";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	// a dedicated communicator allows the non-blocking reductions of the monitors to overlap each other
+	if (auto ret = MPI_Comm_dup(MPI_COMM_WORLD, &MPI_comm_monitors))
+	{
+		std::stringstream message;
+		message << "'MPI_Comm_dup' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <class M>
+Monitor_reduction_MPI<M>
+::~Monitor_reduction_MPI()
+{
+	// the MPI objects cannot be released anymore after 'MPI_Finalize'
+	int finalized = 0;
+	MPI_Finalized(&finalized);
+	if (finalized)
+		return;
+
+	// the buffers of the pending non-blocking reduction are members of this monitor
+	if (MPI_req_monitors != MPI_REQUEST_NULL)
+		MPI_Wait(&MPI_req_monitors, MPI_STATUS_IGNORE);
+
+	MPI_Comm_free(&MPI_comm_monitors     );
+	MPI_Op_free  (&MPI_Op_reduce_monitors);
+	MPI_Type_free(&MPI_monitor_vals      );
 }
 
 template <class M>
 void Monitor_reduction_MPI<M>
 ::_reduce(bool fully)
 {
-	fully = false;
-
 	Monitor_reduction_M<M>::_reduce(fully);
 
-	Attributes mvals_send = M::get_attributes(), mvals_recv;
-	MPI_Allreduce(&mvals_send, &mvals_recv, 1, MPI_monitor_vals, MPI_Op_reduce_monitors, MPI_COMM_WORLD);
+	mvals_local = M::get_attributes();
+
+	// keep the attributes of all the processes until the next non-blocking reduction is completed
+	if (is_glob)
+		M::copy(mvals_glob);
+}
+
+template <class M>
+void Monitor_reduction_MPI<M>
+::_start_reduction()
+{
+	mvals_send = mvals_local;
+
+	if (auto ret = MPI_Iallreduce(&mvals_send, &mvals_recv, 1, MPI_monitor_vals, MPI_Op_reduce_monitors,
+	                              MPI_comm_monitors, &MPI_req_monitors))
+	{
+		std::stringstream message;
+		message << "'MPI_Iallreduce' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <class M>
+bool Monitor_reduction_MPI<M>
+::_complete_reduction(bool wait)
+{
+	if (MPI_req_monitors == MPI_REQUEST_NULL)
+		return true;
+
+	int completed = 1;
+	if (wait)
+		MPI_Wait(&MPI_req_monitors, MPI_STATUS_IGNORE);
+	else
+		MPI_Test(&MPI_req_monitors, &completed, MPI_STATUS_IGNORE);
+
+	if (completed)
+	{
+		mvals_glob = mvals_recv;
+		is_glob    = true;
+		M::copy(mvals_glob);
+	}
+
+	return completed != 0;
+}
+
+template <class M>
+void Monitor_reduction_MPI<M>
+::_reduce_fully()
+{
+	reduce_histograms(*this);
+}
+
+template <class M>
+template <typename B>
+void Monitor_reduction_MPI<M>
+::reduce_histograms(Monitor_BFER<B>& m)
+{
+	reduce_histogram(m.get_err_hist());
+}
+
+template <class M>
+template <typename B, typename R>
+void Monitor_reduction_MPI<M>
+::reduce_histograms(Monitor_MI<B,R>& m)
+{
+	reduce_histogram(m.get_mutinfo_hist());
+}
+
+template <class M>
+template <typename H>
+void Monitor_reduction_MPI<M>
+::reduce_histogram(const tools::Histogram<H>& hist)
+{
+	int np, rank;
+	MPI_Comm_size(MPI_comm_monitors, &np  );
+	MPI_Comm_rank(MPI_comm_monitors, &rank);
+
+	std::vector<int               > keys;
+	std::vector<unsigned long long> counts;
+	for (auto& h : hist.get_hist())
+	{
+		keys  .push_back(h.first );
+		counts.push_back(h.second);
+	}
+
+	int n_send = (int)keys.size();
+	std::vector<int> n_recv(np), displs(np, 0);
+	if (auto ret = MPI_Allgather(&n_send, 1, MPI_INT, n_recv.data(), 1, MPI_INT, MPI_comm_monitors))
+	{
+		std::stringstream message;
+		message << "'MPI_Allgather' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto p = 1; p < np; p++)
+		displs[p] = displs[p -1] + n_recv[p -1];
+
+	std::vector<int               > keys_recv  (displs[np -1] + n_recv[np -1]);
+	std::vector<unsigned long long> counts_recv(displs[np -1] + n_recv[np -1]);
+
+	if (auto ret = MPI_Allgatherv(keys.data(), n_send, MPI_INT, keys_recv.data(), n_recv.data(), displs.data(),
+	                              MPI_INT, MPI_comm_monitors))
+	{
+		std::stringstream message;
+		message << "'MPI_Allgatherv' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (auto ret = MPI_Allgatherv(counts.data(), n_send, MPI_UNSIGNED_LONG_LONG, counts_recv.data(), n_recv.data(),
+	                              displs.data(), MPI_UNSIGNED_LONG_LONG, MPI_comm_monitors))
+	{
+		std::stringstream message;
+		message << "'MPI_Allgatherv' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the local histogram is already in this monitor, only collect the ones of the other processes
+	tools::Histogram<H> others = hist;
+	others.reset();
+	for (auto p = 0; p < np; p++)
+		if (p != rank)
+			for (auto i = displs[p]; i < displs[p] + n_recv[p]; i++)
+				others.add_value(others.uncalibrate_val(keys_recv[i]), (size_t)counts_recv[i]);
 
-	M::copy(mvals_recv);
+	M::collect(others);
+}
+
+template <class M>
+void Monitor_reduction_MPI<M>
+::reduce_histogram(const tools::Histogram_dense& hist)
+{
+	// the dense histograms are summed bin by bin, the last element is the overflow bucket
+	unsigned long long n_bins = hist.get_n_bins(), n_bins_max = 0;
+	if (auto ret = MPI_Allreduce(&n_bins, &n_bins_max, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, MPI_comm_monitors))
+	{
+		std::stringstream message;
+		message << "'MPI_Allreduce' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<unsigned long long> counts(n_bins_max +1, 0), counts_glob(n_bins_max +1);
+	std::copy(hist.get_hist().begin(), hist.get_hist().end(), counts.begin());
+	counts.back() = hist.get_overflow();
+
+	if (auto ret = MPI_Allreduce(counts.data(), counts_glob.data(), (int)counts.size(), MPI_UNSIGNED_LONG_LONG,
+	                             MPI_SUM, MPI_comm_monitors))
+	{
+		std::stringstream message;
+		message << "'MPI_Allreduce' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the local histogram is already in this monitor, only collect the ones of the other processes
+	tools::Histogram_dense others((size_t)n_bins_max);
+	for (size_t v = 0; v < counts.size(); v++) // the overflow is added as the 'n_bins_max' out of range value
+		if (counts_glob[v] != counts[v])
+			others.add_value((int)v, (size_t)(counts_glob[v] - counts[v]));
+
+	M::collect(others);
 }
 
 template <class M>
@@ -66,6 +250,8 @@ void Monitor_reduction_MPI<M>
 ::reset()
 {
 	Monitor_reduction_M<M>::reset();
+
+	is_glob = false;
 }
 
 template <class M>
@@ -0,0 +1,242 @@
+#include <sstream>
+#include <cmath>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+#include "Module/Quantizer/Fused/Quantizer_fused_BPSK_AWGN.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+namespace
+{
+// SIMD version of the Box Muller method in the polar form, the noise is not scaled by sigma
+inline void awgn_simd(tools::PRNG_MT19937_simd &mt19937_simd, mipp::Reg<float> &n1, mipp::Reg<float> &n2)
+{
+	const auto twopi = (float)(2.0 * 3.14159265358979323846);
+
+	const auto radius = mipp::sqrt(mipp::log(mt19937_simd.randf_oo()) * -2.f);
+	const auto theta  = mt19937_simd.randf_oo() * twopi;
+
+	mipp::Reg<float> sintheta, costheta;
+	mipp::sincos(theta, sintheta, costheta);
+
+	n1 = radius * costheta;
+	n2 = radius * sintheta;
+}
+
+// seq version of the Box Muller method in the polar form, the noise is not scaled by sigma
+inline void awgn(tools::PRNG_MT19937 &mt19937, float &n1, float &n2)
+{
+	const auto twopi = (float)(2.0 * 3.14159265358979323846);
+
+	const auto radius = std::sqrt(std::log(mt19937.randf_oo()) * -2.f);
+	const auto theta  = mt19937.randf_oo() * twopi;
+
+	n1 = radius * std::cos(theta);
+	n2 = radius * std::sin(theta);
+}
+}
+
+template <typename R, typename Q>
+Quantizer_fused_BPSK_AWGN<R,Q>
+::Quantizer_fused_BPSK_AWGN(const int N, const short& fixed_point_pos, const short& saturation_pos,
+                            const bool disable_sig2, const int seed, const int n_frames)
+: Quantizer<R,Q>(N, n_frames),
+  val_max(((1 << (saturation_pos -2))) + ((1 << (saturation_pos -2)) -1)),
+  val_min(-val_max),
+  fixed_point_pos(fixed_point_pos),
+  factor(1 << fixed_point_pos),
+  disable_sig2(disable_sig2),
+  sigma((R)0),
+  llr_factor((R)0),
+  mt19937(),
+  mt19937_simd()
+{
+	const std::string name = "Quantizer_fused_BPSK_AWGN";
+	this->set_name(name);
+
+	if (fixed_point_pos <= 0)
+	{
+		std::stringstream message;
+		message << "'fixed_point_pos' has to be greater than 0 ('fixed_point_pos' = " << fixed_point_pos << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (saturation_pos < 2)
+	{
+		std::stringstream message;
+		message << "'saturation_pos' has to be greater than 1 ('saturation_pos' = " << saturation_pos << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (fixed_point_pos > saturation_pos)
+	{
+		std::stringstream message;
+		message << "'saturation_pos' has to be equal or greater than 'fixed_point_pos' ('saturation_pos' = "
+		        << saturation_pos << ", 'fixed_point_pos' = " << fixed_point_pos << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (sizeof(Q) * 8 < (unsigned) saturation_pos)
+	{
+		std::stringstream message;
+		message << "'saturation_pos' has to be equal or smaller than 'sizeof(Q)' * 8 ('saturation_pos' = "
+		        << saturation_pos << ", 'sizeof(Q)' = " << sizeof(Q) << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->set_seed(seed);
+}
+
+template <typename R, typename Q>
+void Quantizer_fused_BPSK_AWGN<R,Q>
+::set_seed(const int seed)
+{
+	mt19937.seed(seed);
+
+	mipp::vector<int> seeds(mipp::nElReg<int>());
+	for (auto i = 0; i < mipp::nElReg<int>(); i++)
+		seeds[i] = mt19937.rand();
+	mt19937_simd.seed(seeds.data());
+}
+
+template <typename R, typename Q>
+void Quantizer_fused_BPSK_AWGN<R,Q>
+::set_noise(const tools::Noise<R>& noise)
+{
+	noise.is_of_type_throw(tools::Noise_type::SIGMA);
+
+	this->sigma      = noise.get_noise();
+	this->llr_factor = (disable_sig2 ? (R)1 : (R)2 / (this->sigma * this->sigma)) * (R)factor;
+}
+
+template <typename R, typename Q>
+void Quantizer_fused_BPSK_AWGN<R,Q>
+::_process(const R *Y_N1, Q *Y_N2, const int frame_id)
+{
+	std::string message = "Supports only 'float' to 'short' and 'float' to 'signed char' conversions.";
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, message);
+}
+
+namespace aff3ct
+{
+namespace module
+{
+template<>
+void Quantizer_fused_BPSK_AWGN<float,short>
+::_process(const float *Y_N1, short *Y_N2, const int frame_id)
+{
+	auto size = (unsigned)(this->N);
+	auto vectorized_size = (size / mipp::nElmtsPerRegister<short>()) * mipp::nElmtsPerRegister<short>();
+
+	// Q(y) = sat(round((x + sigma * n) * llr_factor)) = sat(round(x * llr_factor + n * sigma * llr_factor))
+	const auto r_x_factor = mipp::Reg<float>(llr_factor);
+	const auto r_n_factor = mipp::Reg<float>(llr_factor * sigma);
+
+	// the frames are not aligned when 'N' is not a multiple of the register size: unaligned loads and stores
+	for (unsigned i = 0; i < vectorized_size; i += 2 * mipp::nElmtsPerRegister<float>())
+	{
+		mipp::Reg<float> r_n_0, r_n_1;
+		awgn_simd(mt19937_simd, r_n_0, r_n_1);
+
+		mipp::Reg<float> r_y_0, r_y_1;
+		r_y_0.loadu(&Y_N1[i + 0 * mipp::nElmtsPerRegister<float>()]);
+		r_y_1.loadu(&Y_N1[i + 1 * mipp::nElmtsPerRegister<float>()]);
+
+		const auto r_q32_0 = r_n_0 * r_n_factor + r_x_factor * r_y_0;
+		const auto r_q32_1 = r_n_1 * r_n_factor + r_x_factor * r_y_1;
+
+		const auto r_q32i_0 = r_q32_0.round().cvt<int>();
+		const auto r_q32i_1 = r_q32_1.round().cvt<int>();
+
+		const auto r_q16i = mipp::pack<int,short>(r_q32i_0, r_q32i_1);
+		r_q16i.sat(val_min, val_max).storeu(&Y_N2[i]);
+	}
+
+	for (unsigned i = vectorized_size; i < size; i += 2)
+	{
+		float n_0, n_1;
+		awgn(mt19937, n_0, n_1);
+
+		Y_N2[i] = (short)tools::saturate((float)std::round((Y_N1[i] + sigma * n_0) * llr_factor),
+		                                 (float)val_min, (float)val_max);
+		if (i +1 < size)
+			Y_N2[i +1] = (short)tools::saturate((float)std::round((Y_N1[i +1] + sigma * n_1) * llr_factor),
+			                                    (float)val_min, (float)val_max);
+	}
+}
+}
+}
+
+namespace aff3ct
+{
+namespace module
+{
+template<>
+void Quantizer_fused_BPSK_AWGN<float,signed char>
+::_process(const float *Y_N1, signed char *Y_N2, const int frame_id)
+{
+	auto size = (unsigned)(this->N);
+	auto vectorized_size = (size / mipp::nElmtsPerRegister<signed char>()) * mipp::nElmtsPerRegister<signed char>();
+
+	const auto r_x_factor = mipp::Reg<float>(llr_factor);
+	const auto r_n_factor = mipp::Reg<float>(llr_factor * sigma);
+
+	// the frames are not aligned when 'N' is not a multiple of the register size: unaligned loads and stores
+	for (unsigned i = 0; i < vectorized_size; i += 4 * mipp::nElmtsPerRegister<float>())
+	{
+		mipp::Reg<float> r_n_0, r_n_1, r_n_2, r_n_3;
+		awgn_simd(mt19937_simd, r_n_0, r_n_1);
+		awgn_simd(mt19937_simd, r_n_2, r_n_3);
+
+		mipp::Reg<float> r_y_0, r_y_1, r_y_2, r_y_3;
+		r_y_0.loadu(&Y_N1[i + 0 * mipp::nElmtsPerRegister<float>()]);
+		r_y_1.loadu(&Y_N1[i + 1 * mipp::nElmtsPerRegister<float>()]);
+		r_y_2.loadu(&Y_N1[i + 2 * mipp::nElmtsPerRegister<float>()]);
+		r_y_3.loadu(&Y_N1[i + 3 * mipp::nElmtsPerRegister<float>()]);
+
+		const auto r_q32_0 = r_n_0 * r_n_factor + r_x_factor * r_y_0;
+		const auto r_q32_1 = r_n_1 * r_n_factor + r_x_factor * r_y_1;
+		const auto r_q32_2 = r_n_2 * r_n_factor + r_x_factor * r_y_2;
+		const auto r_q32_3 = r_n_3 * r_n_factor + r_x_factor * r_y_3;
+
+		const auto r_q32i_0 = r_q32_0.round().cvt<int>();
+		const auto r_q32i_1 = r_q32_1.round().cvt<int>();
+		const auto r_q32i_2 = r_q32_2.round().cvt<int>();
+		const auto r_q32i_3 = r_q32_3.round().cvt<int>();
+
+		const auto r_q16i_0 = mipp::pack<int,short>(r_q32i_0, r_q32i_1);
+		const auto r_q16i_1 = mipp::pack<int,short>(r_q32i_2, r_q32i_3);
+
+		const auto r_q8i = mipp::pack<short,signed char>(r_q16i_0, r_q16i_1);
+		r_q8i.sat(val_min, val_max).storeu(&Y_N2[i]);
+	}
+
+	for (unsigned i = vectorized_size; i < size; i += 2)
+	{
+		float n_0, n_1;
+		awgn(mt19937, n_0, n_1);
+
+		Y_N2[i] = (signed char)tools::saturate((float)std::round((Y_N1[i] + sigma * n_0) * llr_factor),
+		                                       (float)val_min, (float)val_max);
+		if (i +1 < size)
+			Y_N2[i +1] = (signed char)tools::saturate((float)std::round((Y_N1[i +1] + sigma * n_1) * llr_factor),
+			                                          (float)val_min, (float)val_max);
+	}
+}
+}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Quantizer_fused_BPSK_AWGN<R_8,Q_8>;
+template class aff3ct::module::Quantizer_fused_BPSK_AWGN<R_16,Q_16>;
+template class aff3ct::module::Quantizer_fused_BPSK_AWGN<R_32,Q_32>;
+template class aff3ct::module::Quantizer_fused_BPSK_AWGN<R_64,Q_64>;
+#else
+template class aff3ct::module::Quantizer_fused_BPSK_AWGN<R,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
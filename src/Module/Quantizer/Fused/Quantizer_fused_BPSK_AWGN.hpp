@@ -0,0 +1,72 @@
+/*!
+ * \file
+ * \brief Fuses the AWGN channel, the BPSK demodulation and the power of two quantization in a single pass.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef QUANTIZER_FUSED_BPSK_AWGN_HPP_
+#define QUANTIZER_FUSED_BPSK_AWGN_HPP_
+
+#include "Tools/Algo/PRNG/PRNG_MT19937.hpp"
+#include "Tools/Algo/PRNG/PRNG_MT19937_simd.hpp"
+#include "Tools/Noise/Noise.hpp"
+#include "Module/Quantizer/Quantizer.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Quantizer_fused_BPSK_AWGN
+ *
+ * \brief Fuses the AWGN channel, the BPSK demodulation and the power of two quantization in a single pass.
+ *
+ * The input is the BPSK modulated signal (+1/-1) and the output is the quantized LLRs. For each SIMD register, the
+ * Gaussian noise is drawn (Box-Muller method), added to the signal, scaled by 2/sigma^2 and by the fixed-point
+ * factor, rounded and saturated without storing the intermediate noisy signal nor the floating-point LLRs.
+ *
+ * \tparam R: type of the reals (floating-point representation), only 'float' is supported.
+ * \tparam Q: type of the quantized LLRs, only 'short' and 'signed char' are supported.
+ */
+template <typename R = float, typename Q = short>
+class Quantizer_fused_BPSK_AWGN : public Quantizer<R,Q>
+{
+private:
+	const int   val_max;
+	const int   val_min;
+	const short fixed_point_pos; // 0 = no decimal part
+	const int   factor;
+	const bool  disable_sig2;
+
+	R sigma;
+	R llr_factor; // 2/sigma^2 (or 1 when disable_sig2) multiplied by the fixed-point factor
+
+	tools::PRNG_MT19937      mt19937;      // Mersenne Twister 19937 (scalar)
+	tools::PRNG_MT19937_simd mt19937_simd; // Mersenne Twister 19937 (SIMD)
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param N:               size of one frame.
+	 * \param fixed_point_pos: position of the fixed point in the quantized LLRs.
+	 * \param saturation_pos:  number of bits of the quantized LLRs.
+	 * \param disable_sig2:    do not scale the LLRs by 2/sigma^2.
+	 * \param seed:            seed of the Gaussian noise generator.
+	 * \param n_frames:        number of frames to process in the Quantizer.
+	 */
+	Quantizer_fused_BPSK_AWGN(const int N, const short& fixed_point_pos, const short& saturation_pos,
+	                          const bool disable_sig2 = false, const int seed = 0, const int n_frames = 1);
+	virtual ~Quantizer_fused_BPSK_AWGN() = default;
+
+	void set_seed (const int seed);
+	void set_noise(const tools::Noise<R>& noise);
+
+protected:
+	void _process(const R *Y_N1, Q *Y_N2, const int frame_id);
+};
+}
+}
+
+#endif /* QUANTIZER_FUSED_BPSK_AWGN_HPP_ */
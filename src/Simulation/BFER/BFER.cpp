@@ -4,6 +4,8 @@
 #include <sstream>
 #include <fstream>
 #include <iomanip>
+#include <cstdio>
+#include <limits>
 #include <thread>
 #include <string>
 #include <ios>
@@ -32,9 +34,18 @@ BFER<B,R,Q>
 
   bit_rate((float)params_BFER.src->K / (float)params_BFER.cdc->N),
 
+  pinning(params_BFER.n_threads, params_BFER.pin_policy, params_BFER.pin_list, params_BFER.pin_no_smt),
+
   monitor_mi(params_BFER.n_threads),
   monitor_er(params_BFER.n_threads),
-  dumper    (params_BFER.n_threads)
+  dumper    (params_BFER.n_threads),
+
+  n_resumes      (0),
+  ckpt_noise_idx (0),
+  monitor_mi_ckpt(params_BFER.n_threads),
+  monitor_er_ckpt(params_BFER.n_threads),
+  mutex_ckpt     (params_BFER.n_threads),
+  t_ckpt         (params_BFER.n_threads)
 {
 	if (params_BFER.n_threads < 1)
 	{
@@ -51,6 +62,16 @@ BFER<B,R,Q>
 		dumper_red.reset(new tools::Dumper_reduction(dumper));
 	}
 
+	if (!params_BFER.ckpt_path.empty())
+	{
+		if (params_BFER.err_track_revert)
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The checkpoints can't be used when the bad "
+			                                                            "frames are replayed.");
+
+		if (params_BFER.ckpt_resume)
+			this->load_checkpoint();
+	}
+
 	if (!params_BFER.noise->pdf_path.empty())
 		distributions.reset(new tools::Distributions<R>(params_BFER.noise->pdf_path,
 		                                                tools::Distribution_mode::SUMMATION,
@@ -76,6 +97,8 @@ void BFER<B,R,Q>
 	// join the slave threads with the master thread
 	for (auto tid = 1; tid < params_BFER.n_threads; tid++)
 		threads[tid -1].join();
+
+	this->pinning.unpin();
 }
 
 template <typename B, typename R, typename Q>
@@ -167,9 +190,13 @@ void BFER<B,R,Q>
 
 		this->t_start_noise_point = std::chrono::steady_clock::now();
 
+		// restore the monitors from the checkpoint, if the noise point is over there is nothing to simulate
+		const bool point_done = this->restore_point(noise_idx);
+
 		try
 		{
-			this->_launch();
+			if (!point_done)
+				this->_launch();
 			module::Monitor_reduction::is_done_all(true, true); // final reduction
 		}
 		catch (std::exception const& e)
@@ -211,6 +238,18 @@ void BFER<B,R,Q>
 			}
 		}
 
+		// the noise point is done only if it stopped on its own criteria, not on an interruption (Ctrl+c)
+		if (!params_BFER.ckpt_path.empty() && !this->simu_error)
+		{
+			const auto point_done = !tools::Terminal::is_interrupt() &&
+			                        (this->monitor_er_red->fe_limit_achieved()    ||
+			                         this->monitor_er_red->frame_limit_achieved() ||
+			                         this->stop_time_reached());
+
+			this->ckpt_records[noise_idx] = this->serialize_point(noise_idx, point_done, false);
+			this->save_checkpoint();
+		}
+
 		if (!params_BFER.crit_nostop && !params_BFER.err_track_revert && !tools::Terminal::is_interrupt() &&
 		    !this->monitor_er_red->fe_limit_achieved() &&
 		    (this->monitor_er_red->frame_limit_achieved() || this->stop_time_reached()))
@@ -219,7 +258,7 @@ void BFER<B,R,Q>
 
 		if (params_BFER.mnt_er->err_hist != -1)
 		{
-			auto err_hist = monitor_er_red->get_err_hist();
+			const auto &err_hist = monitor_er_red->get_err_hist();
 
 			if (err_hist.get_n_values() != 0)
 			{
@@ -252,7 +291,7 @@ void BFER<B,R,Q>
 			}
 		}
 
-		if (this->dumper_red != nullptr && !this->simu_error)
+		if (this->dumper_red != nullptr && !this->simu_error && !point_done)
 		{
 			std::stringstream s_noise;
 			s_noise << std::setprecision(2) << std::fixed << this->noise->get_noise();
@@ -299,7 +338,7 @@ template <typename B, typename R, typename Q>
 std::unique_ptr<tools::Terminal> BFER<B,R,Q>
 ::build_terminal()
 {
-	return std::unique_ptr<tools::Terminal>(params_BFER.ter->build(this->reporters));
+	return std::unique_ptr<tools::Terminal>(params_BFER.ter->build(this->reporters, &this->modules));
 }
 
 template <typename B, typename R, typename Q>
@@ -352,6 +391,19 @@ void BFER<B,R,Q>
 		this->monitor_mi_red.reset(new Monitor_MI_reduction_type(this->monitor_mi));
 	}
 
+	if (!params_BFER.ckpt_path.empty())
+	{
+		// build the monitors to snapshot the state of each thread for the checkpoints
+		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+		{
+			this->monitor_er_ckpt[tid].reset(new Monitor_BFER_type(*this->monitor_er[tid]));
+			if (params_BFER.mnt_mutinfo)
+				this->monitor_mi_ckpt[tid].reset(new Monitor_MI_type(*this->monitor_mi[tid]));
+
+			this->monitor_er[tid]->add_handler_check(std::bind(&BFER<B,R,Q>::checkpoint_thread, this, tid));
+		}
+	}
+
 	module::Monitor_reduction::set_master_thread_id(std::this_thread::get_id());
 #ifdef AFF3CT_MPI
 	module::Monitor_reduction::set_reduce_frequency(params_BFER.mnt_mpi_comm_freq);
@@ -377,6 +429,8 @@ void BFER<B,R,Q>
 {
 	try
 	{
+		// pin the thread before allocating its modules: their buffers are first touched on its own NUMA node
+		simu->pinning.pin(tid);
 		simu->__build_communication_chain(tid);
 
 		if (simu->params_BFER.err_track_enable)
@@ -428,6 +482,251 @@ bool BFER<B,R,Q>
 	                                                                     params_BFER.stop_time;
 }
 
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::seed_engine(std::mt19937 &rd_engine, const int tid) const
+{
+	if (this->n_resumes == 0)
+		rd_engine.seed(params_BFER.local_seed + tid);
+	else
+	{
+		// draw other frames than the ones already accounted in the checkpoint
+		std::seed_seq seq = {(unsigned)(params_BFER.local_seed + tid), this->n_resumes};
+		rd_engine.seed(seq);
+	}
+}
+
+template <typename B, typename R, typename Q>
+std::string BFER<B,R,Q>
+::get_ckpt_path() const
+{
+#ifdef AFF3CT_MPI
+	return params_BFER.ckpt_path + "." + std::to_string(params_BFER.mpi_rank);
+#else
+	return params_BFER.ckpt_path;
+#endif
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::load_checkpoint()
+{
+	const auto path = this->get_ckpt_path();
+
+	std::ifstream file(path);
+	if (!file.is_open())
+		return; // there is nothing to resume, start from the first noise point
+
+	std::string tag;
+	unsigned version = 0;
+	file >> tag >> version;
+	if (tag != "aff3ct_bfer_checkpoint" || version != 1)
+	{
+		std::stringstream message;
+		message << "'" << path << "' is not a valid checkpoint file.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::istringstream ss(line);
+		std::string key;
+		if (!(ss >> key))
+			continue;
+
+		if (key == "resumes")
+			ss >> this->n_resumes;
+		else if (key == "point")
+		{
+			int    noise_idx;
+			double noise_val;
+			ss >> noise_idx >> noise_val;
+
+			if (ss.fail() || noise_idx < 0 || noise_idx >= (int)params_BFER.noise->range.size() ||
+			    (float)noise_val != params_BFER.noise->range[noise_idx])
+			{
+				std::stringstream message;
+				message << "The checkpoint does not match the simulated noise range ('path' = " << path
+				        << ", 'line' = \"" << line << "\").";
+				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			this->ckpt_records[noise_idx] = line;
+		}
+	}
+
+	this->n_resumes++;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::save_checkpoint()
+{
+	const auto path     = this->get_ckpt_path();
+	const auto path_tmp = path + ".tmp";
+
+	{
+		std::ofstream file(path_tmp, std::ios::out | std::ios::trunc);
+		file << "aff3ct_bfer_checkpoint 1" << std::endl;
+		file << "resumes " << this->n_resumes << std::endl;
+		for (auto &r : this->ckpt_records)
+			file << r.second << std::endl;
+
+		if (!file.good())
+		{
+			std::stringstream message;
+			message << "Impossible to write the checkpoint file ('path_tmp' = " << path_tmp << ").";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	// the previous checkpoint is replaced only when the new one is complete
+	if (std::rename(path_tmp.c_str(), path.c_str()) != 0)
+	{
+		std::stringstream message;
+		message << "Impossible to rename the checkpoint file ('path_tmp' = " << path_tmp << ", 'path' = "
+		        << path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::checkpoint_thread(const int tid)
+{
+	const auto t_now = std::chrono::steady_clock::now();
+	if (t_now - this->t_ckpt[tid] < params_BFER.ckpt_freq)
+		return;
+
+	this->t_ckpt[tid] = t_now;
+
+	// each thread takes a snapshot of its own monitors
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_ckpt[tid]);
+		this->monitor_er_ckpt[tid]->copy(*this->monitor_er[tid], true);
+		if (this->monitor_mi_ckpt[tid] != nullptr)
+			this->monitor_mi_ckpt[tid]->copy(*this->monitor_mi[tid], true);
+	}
+
+	// and the master thread writes the checkpoint file
+	if (tid == 0)
+	{
+		this->ckpt_records[this->ckpt_noise_idx] = this->serialize_point(this->ckpt_noise_idx, false, true);
+		this->save_checkpoint();
+	}
+}
+
+template <typename B, typename R, typename Q>
+bool BFER<B,R,Q>
+::restore_point(const int noise_idx)
+{
+	if (params_BFER.ckpt_path.empty())
+		return false;
+
+	this->ckpt_noise_idx = noise_idx;
+	for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_ckpt[tid]);
+		this->monitor_er_ckpt[tid]->reset();
+		if (this->monitor_mi_ckpt[tid] != nullptr)
+			this->monitor_mi_ckpt[tid]->reset();
+		this->t_ckpt[tid] = std::chrono::steady_clock::now();
+	}
+
+	auto it = this->ckpt_records.find(noise_idx);
+	if (it == this->ckpt_records.end())
+		return false;
+
+	std::istringstream ss(it->second);
+	std::string key;
+	int idx = 0, done = 0, has_mi = 0;
+	double noise_val;
+	size_t n_bins = 0;
+	unsigned long long n_fra = 0, n_be = 0, n_fe = 0;
+	tools::Histogram_dense err_hist(params_BFER.mnt_er->K +1);
+
+	ss >> key >> idx >> noise_val >> done >> n_fra >> n_be >> n_fe >> n_bins;
+	for (size_t b = 0; b < n_bins && !ss.fail(); b++)
+	{
+		int    val;
+		size_t count;
+		ss >> val >> count;
+		err_hist.add_value(val, count);
+	}
+	ss >> has_mi;
+
+	unsigned long long n_trials = 0;
+	R MI = (R)0, MI_max = (R)0, MI_min = (R)0;
+	if (has_mi)
+		ss >> n_trials >> MI >> MI_max >> MI_min;
+
+	if (ss.fail())
+	{
+		std::stringstream message;
+		message << "The checkpoint of the noise point is corrupted ('noise_idx' = " << noise_idx << ", 'line' = \""
+		        << it->second << "\").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the previous results are accounted in the monitors of the master thread
+	this->monitor_er[0]->collect(n_fra, n_be, n_fe);
+	this->monitor_er[0]->collect(err_hist);
+	if (has_mi && this->monitor_mi[0] != nullptr)
+		this->monitor_mi[0]->collect(n_trials, MI, MI_max, MI_min);
+
+	return done != 0;
+}
+
+template <typename B, typename R, typename Q>
+std::string BFER<B,R,Q>
+::serialize_point(const int noise_idx, const bool done, const bool snapshot)
+{
+	// merge the monitors of all the threads (the MPI reduction is not used: each process has its own checkpoint)
+	Monitor_BFER_type mnt_er(*this->monitor_er[0]);
+	std::unique_ptr<Monitor_MI_type> mnt_mi(this->monitor_mi[0] != nullptr ?
+	                                        new Monitor_MI_type(*this->monitor_mi[0]) : nullptr);
+
+	for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+	{
+		if (snapshot)
+		{
+			std::lock_guard<std::mutex> lock(this->mutex_ckpt[tid]);
+			mnt_er.collect(*this->monitor_er_ckpt[tid], true);
+			if (mnt_mi != nullptr)
+				mnt_mi->collect(*this->monitor_mi_ckpt[tid], true);
+		}
+		else
+		{
+			mnt_er.collect(*this->monitor_er[tid], true);
+			if (mnt_mi != nullptr)
+				mnt_mi->collect(*this->monitor_mi[tid], true);
+		}
+	}
+
+	std::stringstream ss;
+	ss << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+	const auto& hist = mnt_er.get_err_hist().get_hist();
+
+	ss << "point " << noise_idx << " " << (double)params_BFER.noise->range[noise_idx] << " " << (done ? 1 : 0) << " "
+	   << mnt_er.get_n_analyzed_fra() << " " << mnt_er.get_n_be() << " " << mnt_er.get_n_fe() << " "
+	   << std::count_if(hist.begin(), hist.end(), [](const size_t c) { return c != 0; });
+	for (size_t v = 0; v < hist.size(); v++)
+		if (hist[v])
+			ss << " " << v << " " << hist[v];
+
+	if (mnt_mi != nullptr)
+	{
+		ss << " 1 " << mnt_mi->get_n_trials() << " " << mnt_mi->get_MI() << " " << mnt_mi->get_MI_max() << " "
+		   << mnt_mi->get_MI_min();
+	}
+	else
+		ss << " 0";
+
+	return ss.str();
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
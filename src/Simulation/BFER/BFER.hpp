@@ -1,10 +1,13 @@
 #ifndef SIMULATION_BFER_HPP_
 #define SIMULATION_BFER_HPP_
 
+#include <random>
+#include <string>
 #include <mutex>
 #include <chrono>
 #include <vector>
 #include <memory>
+#include <map>
 
 #include "Factory/Simulation/BFER/BFER.hpp"
 #include "Tools/Display/Reporter/Reporter.hpp"
@@ -13,6 +16,7 @@
 #include "Tools/Display/Dumper/Dumper_reduction.hpp"
 #include "Tools/Math/Distribution/Distributions.hpp"
 #include "Tools/Noise/Noise.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
 #include "Module/Monitor/MI/Monitor_MI.hpp"
 #include "Module/Monitor/BFER/Monitor_BFER.hpp"
 #include "Module/Monitor/Monitor_reduction.hpp"
@@ -42,6 +46,9 @@ protected:
 
 	std::unique_ptr<tools::Noise<R>> noise; // current simulated noise
 
+	// placement of the threads on the CPUs (and on the NUMA nodes)
+	const tools::Thread_pinning pinning;
+
 	// the monitors of the the BFER simulation
 	using Monitor_BFER_type = module::Monitor_BFER<B>;
 	using Monitor_MI_type   = module::Monitor_MI<B,R>;
@@ -74,6 +81,15 @@ protected:
 
 	std::chrono::steady_clock::time_point t_start_noise_point;
 
+	// checkpoint of the simulation state (to resume it later)
+	unsigned                                           n_resumes;       // number of times the simulation was resumed
+	int                                                ckpt_noise_idx;  // index of the noise point in progress
+	std::map<int, std::string>                         ckpt_records;    // serialized noise points (key: noise index)
+	std::vector<std::unique_ptr<Monitor_MI_type  >>    monitor_mi_ckpt; // per-thread snapshots of the monitors
+	std::vector<std::unique_ptr<Monitor_BFER_type>>    monitor_er_ckpt;
+	std::vector<std::mutex>                            mutex_ckpt;
+	std::vector<std::chrono::steady_clock::time_point> t_ckpt;
+
 public:
 	explicit BFER(const factory::BFER::parameters& params_BFER);
 	virtual ~BFER() = default;
@@ -93,6 +109,15 @@ protected:
 	virtual bool keep_looping_noise_point();
 	bool stop_time_reached();
 
+	void seed_engine(std::mt19937 &rd_engine, const int tid) const;
+
+	std::string get_ckpt_path    (                                                        ) const;
+	void        load_checkpoint  (                                                        );
+	void        save_checkpoint  (                                                        );
+	void        checkpoint_thread(const int tid                                           );
+	bool        restore_point    (const int noise_idx                                     );
+	std::string serialize_point  (const int noise_idx, const bool done, const bool snapshot);
+
 private:
 	static void start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid);
 };
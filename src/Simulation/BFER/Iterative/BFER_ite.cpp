@@ -29,7 +29,7 @@ BFER_ite<B,R,Q>
   rd_engine_seed(params_BFER_ite.n_threads)
 {
 	for (auto tid = 0; tid < params_BFER_ite.n_threads; tid++)
-		rd_engine_seed[tid].seed(params_BFER_ite.local_seed + tid);
+		this->seed_engine(rd_engine_seed[tid], tid);
 
 	this->add_module("source"         , params_BFER_ite.n_threads);
 	this->add_module("crc"            , params_BFER_ite.n_threads);
@@ -44,6 +44,8 @@ void BFER_ite_threads<B,R,Q>
 	for (auto tid = 1; tid < this->params_BFER_ite.n_threads; tid++)
 		threads[tid -1].join();
 
+	this->pinning.unpin();
+
 	if (!this->prev_err_messages.empty())
 		throw std::runtime_error(this->prev_err_messages.back());
 }
@@ -54,6 +56,7 @@ void BFER_ite_threads<B,R,Q>
 {
 	try
 	{
+		simu->pinning.pin(tid);
 		simu->sockets_binding(tid);
 		simu->simulation_loop(tid);
 	}
@@ -4,6 +4,7 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Factory/Module/Coset/Coset.hpp"
+#include "Module/Quantizer/Fused/Quantizer_fused_BPSK_AWGN.hpp"
 #include "Simulation/BFER/Standard/BFER_std.hpp"
 
 using namespace aff3ct;
@@ -27,7 +28,7 @@ BFER_std<B,R,Q>
   rd_engine_seed(params_BFER_std.n_threads)
 {
 	for (auto tid = 0; tid < params_BFER_std.n_threads; tid++)
-		rd_engine_seed[tid].seed(params_BFER_std.local_seed + tid);
+		this->seed_engine(rd_engine_seed[tid], tid);
 
 	this->add_module("source"    , params_BFER_std.n_threads);
 	this->add_module("crc"       , params_BFER_std.n_threads);
@@ -136,6 +137,9 @@ void BFER_std<B,R,Q>
 		this->channel[tid]->set_noise(*this->noise);
 		this->modem  [tid]->set_noise(*this->noise);
 		this->codec  [tid]->set_noise(*this->noise);
+
+		if (this->params_BFER_std.fusion)
+			dynamic_cast<module::Quantizer_fused_BPSK_AWGN<R,Q>&>(*this->quantizer[tid]).set_noise(*this->noise);
 	}
 }
 
@@ -223,6 +227,19 @@ template <typename B, typename R, typename Q>
 std::unique_ptr<module::Quantizer<R,Q>> BFER_std<B,R,Q>
 ::build_quantizer(const int tid)
 {
+	if (params_BFER_std.fusion)
+	{
+		const auto seed_qnt = rd_engine_seed[tid]();
+
+		return std::unique_ptr<module::Quantizer<R,Q>>(
+			new module::Quantizer_fused_BPSK_AWGN<R,Q>(params_BFER_std.qnt->size,
+			                                           params_BFER_std.qnt->n_decimals,
+			                                           params_BFER_std.qnt->n_bits,
+			                                           params_BFER_std.mdm->no_sig2,
+			                                           seed_qnt,
+			                                           params_BFER_std.qnt->n_frames));
+	}
+
 	return std::unique_ptr<module::Quantizer<R,Q>>(params_BFER_std.qnt->template build<R,Q>());
 }
 
@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Display/Statistics/Benchmark.hpp"
+#include "Simulation/BFER/Standard/Bench/BFER_std_bench.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::simulation;
+
+template <typename B, typename R, typename Q>
+BFER_std_bench<B,R,Q>
+::BFER_std_bench(const factory::BFER_std::parameters &params_BFER_std)
+: BFER_std_threads<B,R,Q>(params_BFER_std),
+  chain_done(false)
+{
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_bench<B,R,Q>
+::_launch()
+{
+	BFER_std<B,R,Q>::_launch();
+
+	this->pinning.pin(0);
+	this->sockets_binding(0);
+
+	// execute the communication chain once to fill the sockets with frames at the current noise
+	this->chain_done = false;
+	this->simulation_loop(0);
+
+	std::vector<tools::Benchmark::Result> results;
+	for (auto &m : this->get_chain(0))
+		for (auto &t : m.second->tasks)
+			if (t->get_n_calls() && this->is_selected(m.first, t->get_name()))
+			{
+				results.push_back(tools::Benchmark::run(*t, this->params_BFER_std.bench_warmup,
+				                                            this->params_BFER_std.bench_reps));
+				results.back().module_name = m.first;
+			}
+
+	this->pinning.unpin();
+
+	std::stringstream s_noise;
+	s_noise << this->noise->get_noise() << this->noise->get_unity();
+
+	std::cout << "#" << std::endl;
+	std::cout << "# " << rang::style::bold << "Benchmark" << rang::style::reset << " (noise = " << s_noise.str()
+	          << ", " << this->params_BFER_std.src->n_frames << " frame(s) per call, "
+	          << this->params_BFER_std.bench_warmup << " warm-up and " << this->params_BFER_std.bench_reps
+	          << " timed call(s) per task):" << std::endl;
+	tools::Benchmark::show(results, std::cout);
+	std::cout << "#" << std::endl;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_bench<B,R,Q>
+::keep_looping_noise_point()
+{
+	if (this->chain_done || tools::Terminal::is_interrupt())
+		return false;
+
+	this->chain_done = true;
+	return true;
+}
+
+template <typename B, typename R, typename Q>
+std::vector<std::pair<std::string, module::Module*>> BFER_std_bench<B,R,Q>
+::get_chain(const int tid)
+{
+	return {{"source",     this->source    [tid].get()                         },
+	        {"crc",        this->crc       [tid].get()                         },
+	        {"encoder",    this->codec     [tid]->get_encoder().get()          },
+	        {"puncturer",  this->codec     [tid]->get_puncturer().get()        },
+	        {"modem",      this->modem     [tid].get()                         },
+	        {"channel",    this->channel   [tid].get()                         },
+	        {"quantizer",  this->quantizer [tid].get()                         },
+	        {"coset_real", this->coset_real[tid].get()                         },
+	        {"decoder",    this->codec     [tid]->get_decoder_siho().get()     },
+	        {"coset_bit",  this->coset_bit [tid].get()                         },
+	        {"monitor",    this->monitor_er[tid].get()                         }};
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_bench<B,R,Q>
+::is_selected(const std::string &module_name, const std::string &task_name) const
+{
+	const auto &tasks = this->params_BFER_std.bench_tasks;
+	return tasks.empty() ||
+	       std::find(tasks.begin(), tasks.end(), module_name                   ) != tasks.end() ||
+	       std::find(tasks.begin(), tasks.end(), module_name + "::" + task_name) != tasks.end();
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::simulation::BFER_std_bench<B_8,R_8,Q_8>;
+template class aff3ct::simulation::BFER_std_bench<B_16,R_16,Q_16>;
+template class aff3ct::simulation::BFER_std_bench<B_32,R_32,Q_32>;
+template class aff3ct::simulation::BFER_std_bench<B_64,R_64,Q_64>;
+#else
+template class aff3ct::simulation::BFER_std_bench<B,R,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
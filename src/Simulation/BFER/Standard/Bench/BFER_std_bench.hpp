@@ -0,0 +1,54 @@
+#ifndef SIMULATION_BFER_STD_BENCH_HPP_
+#define SIMULATION_BFER_STD_BENCH_HPP_
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "Module/Module.hpp"
+#include "Factory/Simulation/BFER/BFER_std.hpp"
+#include "Simulation/BFER/Standard/Threads/BFER_std_threads.hpp"
+
+namespace aff3ct
+{
+namespace simulation
+{
+/*!
+ * \class BFER_std_bench
+ *
+ * \brief Micro-benchmark of the tasks of the standard BFER communication chain.
+ *
+ * For each noise point, the communication chain of the thread 0 is executed once to fill the sockets with frames at
+ * this noise, then each task of the chain is executed alone: first some warm-up calls and then the timed calls. The
+ * latencies of the timed calls are reported per task (average, percentiles, throughputs).
+ */
+template <typename B = int, typename R = float, typename Q = R>
+class BFER_std_bench : public BFER_std_threads<B,R,Q>
+{
+protected:
+	bool chain_done; // true when the communication chain has been executed once on the current noise point
+
+public:
+	explicit BFER_std_bench(const factory::BFER_std::parameters &params_BFER_std);
+	virtual ~BFER_std_bench() = default;
+
+protected:
+	virtual void _launch();
+	virtual bool keep_looping_noise_point();
+
+	/*!
+	 * \brief Returns the modules of the communication chain of the thread 'tid' (in the order of the chain) with
+	 *        their names.
+	 */
+	std::vector<std::pair<std::string, module::Module*>> get_chain(const int tid = 0);
+
+	/*!
+	 * \brief Returns true if the task has to be benchmarked ('bench_tasks' is empty or contains "module" or
+	 *        "module::task").
+	 */
+	bool is_selected(const std::string &module_name, const std::string &task_name) const;
+};
+}
+}
+
+#endif /* SIMULATION_BFER_STD_BENCH_HPP_ */
@@ -43,6 +43,8 @@ void BFER_std_threads<B,R,Q>
 	for (auto tid = 1; tid < this->params_BFER_std.n_threads; tid++)
 		threads[tid -1].join();
 
+	this->pinning.unpin();
+
 	if (!this->prev_err_messages_to_display.empty())
 		throw std::runtime_error(this->prev_err_messages_to_display.back());
 }
@@ -53,6 +55,7 @@ void BFER_std_threads<B,R,Q>
 {
 	try
 	{
+		simu->pinning.pin(tid);
 		simu->sockets_binding(tid);
 		simu->simulation_loop(tid);
 	}
@@ -178,7 +181,12 @@ void BFER_std_threads<B,R,Q>
 		chn[chn::sck::add_noise ::X_N ](mdm[mdm::sck::modulate  ::X_N2]);
 		mdm[mdm::sck::filter    ::Y_N1](chn[chn::sck::add_noise ::Y_N ]);
 		mdm[mdm::sck::demodulate::Y_N1](mdm[mdm::sck::filter    ::Y_N2]);
-		qnt[qnt::sck::process   ::Y_N1](mdm[mdm::sck::demodulate::Y_N2]);
+
+		// the fused quantizer adds the noise and demodulates the modulated signal by itself
+		if (this->params_BFER_std.fusion)
+			qnt[qnt::sck::process::Y_N1](mdm[mdm::sck::modulate  ::X_N2]);
+		else
+			qnt[qnt::sck::process::Y_N1](mdm[mdm::sck::demodulate::Y_N2]);
 	}
 
 	if (this->params_BFER_std.cdc->pct == nullptr || this->params_BFER_std.cdc->pct->type == "NO")
@@ -320,6 +328,10 @@ void BFER_std_threads<B,R,Q>
 			if (this->params_BFER_std.qnt->type != "NO")
 				quantizer[qnt::tsk::process].exec();
 		}
+		else if (this->params_BFER_std.fusion)
+		{
+			quantizer[qnt::tsk::process].exec();
+		}
 		else
 		{
 			if (this->params_BFER_std.chn->type != "NO")
@@ -18,10 +18,10 @@ public:
 protected:
 	virtual void _launch();
 
-private:
 	void sockets_binding(const int tid = 0);
 	void simulation_loop(const int tid = 0);
 
+private:
 	static void start_thread(BFER_std_threads<B,R,Q> *simu, const int tid = 0);
 };
 }
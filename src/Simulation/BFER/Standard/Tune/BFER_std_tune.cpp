@@ -0,0 +1,114 @@
+#include "Tools/Display/Terminal/Terminal.hpp"
+#include "Simulation/BFER/Standard/Tune/BFER_std_tune.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::simulation;
+
+template <typename B, typename R, typename Q>
+BFER_std_tune<B,R,Q>
+::BFER_std_tune(const factory::BFER_std::parameters &params_BFER_std, const std::chrono::milliseconds d_burst)
+: BFER_std_threads<B,R,Q>(params_BFER_std),
+  d_burst(d_burst),
+  timed(false),
+  warmed_up(false),
+  d_measured(0),
+  n_fra(0),
+  n_bytes(0)
+{
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_tune<B,R,Q>
+::_launch()
+{
+	BFER_std<B,R,Q>::_launch();
+
+	this->pinning.pin(0);
+	this->sockets_binding(0);
+
+	// execute the communication chain once to touch the buffers and to fill the caches
+	this->timed     = false;
+	this->warmed_up = false;
+	this->simulation_loop(0);
+
+	const auto n_fra_start = this->monitor_er[0]->get_n_analyzed_fra();
+
+	this->timed   = true;
+	this->t_burst = std::chrono::steady_clock::now();
+	this->simulation_loop(0);
+
+	this->d_measured = std::chrono::steady_clock::now() - this->t_burst;
+
+	this->pinning.unpin();
+	this->n_fra      = this->monitor_er[0]->get_n_analyzed_fra() - n_fra_start;
+
+	this->n_bytes = 0;
+	for (auto &m : this->modules)
+		for (auto &mm : m.second)
+			if (mm != nullptr)
+				for (auto &t : mm->tasks)
+					if (t->get_n_calls())
+						for (auto &s : t->sockets)
+							if (t->get_socket_type(*s) != module::socket_t::SIN)
+								this->n_bytes += s->get_databytes();
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_tune<B,R,Q>
+::keep_looping_noise_point()
+{
+	if (tools::Terminal::is_interrupt())
+		return false;
+
+	if (!this->timed)
+	{
+		if (this->warmed_up)
+			return false;
+
+		this->warmed_up = true;
+		return true;
+	}
+
+	return (std::chrono::steady_clock::now() - this->t_burst) < this->d_burst;
+}
+
+template <typename B, typename R, typename Q>
+double BFER_std_tune<B,R,Q>
+::get_throughput() const
+{
+	if (this->d_measured.count() == 0)
+		return 0.;
+
+	const auto n_bits = (double)this->n_fra * (double)this->params_BFER_std.src->K;
+	return n_bits / ((double)this->d_measured.count() * 1e-3); // bits per us = Mb/s
+}
+
+template <typename B, typename R, typename Q>
+double BFER_std_tune<B,R,Q>
+::get_latency() const
+{
+	if (this->n_fra == 0)
+		return 0.;
+
+	const auto n_calls = (double)this->n_fra / (double)this->params_BFER_std.src->n_frames;
+	return ((double)this->d_measured.count() * 1e-3) / n_calls;
+}
+
+template <typename B, typename R, typename Q>
+size_t BFER_std_tune<B,R,Q>
+::get_working_set() const
+{
+	return this->n_bytes;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::simulation::BFER_std_tune<B_8,R_8,Q_8>;
+template class aff3ct::simulation::BFER_std_tune<B_16,R_16,Q_16>;
+template class aff3ct::simulation::BFER_std_tune<B_32,R_32,Q_32>;
+template class aff3ct::simulation::BFER_std_tune<B_64,R_64,Q_64>;
+#else
+template class aff3ct::simulation::BFER_std_tune<B,R,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,66 @@
+#ifndef SIMULATION_BFER_STD_TUNE_HPP_
+#define SIMULATION_BFER_STD_TUNE_HPP_
+
+#include <chrono>
+#include <cstddef>
+
+#include "Factory/Simulation/BFER/BFER_std.hpp"
+#include "Simulation/BFER/Standard/Threads/BFER_std_threads.hpp"
+
+namespace aff3ct
+{
+namespace simulation
+{
+/*!
+ * \class BFER_std_tune
+ *
+ * \brief Measures the throughput of the standard BFER communication chain on a short burst.
+ *
+ * Used by the auto-tuning of the launcher to compare several numbers of frames per call: for each noise point, the
+ * communication chain of the thread 0 is executed once to touch the buffers (warm-up), then it is executed in loop
+ * during the burst duration. The noise points should be reduced to the first one.
+ */
+template <typename B = int, typename R = float, typename Q = R>
+class BFER_std_tune : public BFER_std_threads<B,R,Q>
+{
+protected:
+	const std::chrono::milliseconds d_burst;
+
+	bool                                     timed;      // false during the warm-up
+	bool                                     warmed_up;  // true when the warm-up call has been done
+	std::chrono::steady_clock::time_point    t_burst;    // start of the timed burst
+	std::chrono::nanoseconds                 d_measured; // duration of the timed burst
+	unsigned long long                       n_fra;      // number of frames simulated during the timed burst
+	size_t                                   n_bytes;    // sum of the sizes of the output sockets of the chain
+
+public:
+	/*!
+	 * \param d_burst: the duration of the timed burst.
+	 */
+	BFER_std_tune(const factory::BFER_std::parameters &params_BFER_std, const std::chrono::milliseconds d_burst);
+	virtual ~BFER_std_tune() = default;
+
+	/*!
+	 * \return the simulation throughput of the burst in information Mb/s (0 if nothing has been measured).
+	 */
+	double get_throughput() const;
+
+	/*!
+	 * \return the average latency of one execution of the chain (one call of each task) in microseconds.
+	 */
+	double get_latency() const;
+
+	/*!
+	 * \return the number of bytes of the output sockets of the executed tasks, the working set of the chain without
+	 *         the internal memory of the modules.
+	 */
+	size_t get_working_set() const;
+
+protected:
+	virtual void _launch();
+	virtual bool keep_looping_noise_point();
+};
+}
+}
+
+#endif /* SIMULATION_BFER_STD_TUNE_HPP_ */
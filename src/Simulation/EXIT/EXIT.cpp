@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <sstream>
 #include <chrono>
+#include <thread>
 #include <limits>
 #include <string>
 #include <cmath>
@@ -28,7 +29,15 @@ EXIT<B,R>
 ::EXIT(const factory::EXIT::parameters& params_EXIT)
 : Simulation (params_EXIT),
   params_EXIT(params_EXIT),
-  sig_a      ((R)0       )
+  sig_a      ((R)0       ),
+  pinning    (params_EXIT.n_threads, params_EXIT.pin_policy, params_EXIT.pin_list, params_EXIT.pin_no_smt),
+  source     (params_EXIT.n_threads),
+  codec      (params_EXIT.n_threads),
+  modem      (params_EXIT.n_threads),
+  modem_a    (params_EXIT.n_threads),
+  channel    (params_EXIT.n_threads),
+  channel_a  (params_EXIT.n_threads),
+  monitor    (params_EXIT.n_threads)
 {
 #ifdef AFF3CT_MPI
 	std::clog << rang::tag::warning << "This simulation is not MPI ready, the same computations will be launched "
@@ -43,8 +52,12 @@ EXIT<B,R>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (params_EXIT.n_threads > 1)
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "EXIT simu does not support the multi-threading.");
+	if (params_EXIT.n_threads < 1)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << params_EXIT.n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 
 	this->add_module("source"   , params_EXIT.n_threads);
 	this->add_module("codec"    , params_EXIT.n_threads);
@@ -56,15 +69,30 @@ EXIT<B,R>
 	this->add_module("channel_a", params_EXIT.n_threads);
 	this->add_module("monitor"  , params_EXIT.n_threads);
 
-	this->monitor = this->build_monitor();
+	// build a monitor to compute the mutual information on each thread
+	for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+	{
+		this->monitor[tid] = this->build_monitor(tid);
+		this->set_module("monitor", tid, this->monitor[tid]);
+	}
 
-	this->set_module("monitor", 0, this->monitor);
+	// build a monitor to reduce the mutual information from the other monitors
+	this->monitor_red.reset(new Monitor_EXIT_reduction_type(this->monitor));
+
+	module::Monitor_reduction::set_master_thread_id(std::this_thread::get_id());
+#ifdef AFF3CT_MPI
+	module::Monitor_reduction::set_reduce_frequency(params_EXIT.mnt_mpi_comm_freq);
+#else
+	module::Monitor_reduction::set_reduce_frequency(std::chrono::milliseconds(0));
+#endif
+	module::Monitor_reduction::reset_all();
+	module::Monitor_reduction::check_reducible();
 
 	auto reporter_noise = new tools::Reporter_noise<R>(this->noise);
 	reporters.push_back(std::unique_ptr<tools::Reporter_noise<R>>(reporter_noise));
-	auto reporter_EXIT = new tools::Reporter_EXIT<B,R>(*this->monitor, this->noise_a);
+	auto reporter_EXIT = new tools::Reporter_EXIT<B,R>(*this->monitor_red, this->noise_a);
 	reporters.push_back(std::unique_ptr<tools::Reporter_EXIT<B,R>>(reporter_EXIT));
-	auto reporter_thr = new tools::Reporter_throughput<uint64_t>(*this->monitor);
+	auto reporter_thr = new tools::Reporter_throughput<uint64_t>(*this->monitor_red);
 	reporters.push_back(std::unique_ptr<tools::Reporter_throughput<uint64_t>>(reporter_thr));
 }
 
@@ -72,47 +100,89 @@ template <typename B, typename R>
 void EXIT<B,R>
 ::_build_communication_chain()
 {
-	const auto N_mod = params_EXIT.mdm->N_mod;
-	const auto K_mod = factory::Modem::get_buffer_size_after_modulation(params_EXIT.mdm->type,
-	                                                                    params_EXIT.cdc->K,
-	                                                                    params_EXIT.mdm->bps,
-	                                                                    params_EXIT.mdm->cpm_upf,
-	                                                                    params_EXIT.mdm->cpm_L);
-
-	// build the objects
-	source    = build_source   (     );
-	codec     = build_codec    (     );
-	modem     = build_modem    (     );
-	modem_a   = build_modem_a  (     );
-	channel   = build_channel  (N_mod);
-	channel_a = build_channel_a(K_mod);
-	terminal  = build_terminal (     );
-
-	this->set_module("source"   , 0, source);
-	this->set_module("codec"    , 0, codec);
-	this->set_module("encoder"  , 0, codec->get_encoder());
-	this->set_module("decoder"  , 0, codec->get_decoder_siso());
-	this->set_module("modem"    , 0, modem);
-	this->set_module("modem_a"  , 0, modem_a);
-	this->set_module("channel"  , 0, channel);
-	this->set_module("channel_a", 0, channel_a);
-
-	this->monitor->add_handler_measure(std::bind(&module::Codec_SISO<B,R>::reset, codec.get()));
-
-	if (codec->get_decoder_siso()->get_n_frames() > 1)
-		throw tools::runtime_error(__FILE__, __LINE__, __func__, "The inter frame is not supported.");
+	// build the communication chain in multi-threaded mode
+	std::vector<std::thread> threads(params_EXIT.n_threads -1);
+	for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+		threads[tid -1] = std::thread(EXIT<B,R>::start_thread_build_comm_chain, this, tid);
+
+	EXIT<B,R>::start_thread_build_comm_chain(this, 0);
+
+	// join the slave threads with the master thread
+	for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+		threads[tid -1].join();
+
+	this->pinning.unpin();
+
+	terminal = build_terminal();
 }
 
 template <typename B, typename R>
 void EXIT<B,R>
-::launch()
+::start_thread_build_comm_chain(EXIT<B,R> *simu, const int tid)
 {
-	this->terminal = this->build_terminal();
+	try
+	{
+		// pin the thread before allocating its modules: their buffers are first touched on its own NUMA node
+		simu->pinning.pin(tid);
+
+		// build the objects
+		simu->source   [tid] = simu->build_source   (tid);
+		simu->codec    [tid] = simu->build_codec    (tid);
+		simu->modem    [tid] = simu->build_modem    (tid);
+		simu->modem_a  [tid] = simu->build_modem_a  (tid);
+		simu->channel  [tid] = simu->build_channel  (tid);
+		simu->channel_a[tid] = simu->build_channel_a(tid);
+
+		simu->set_module("source"   , tid, simu->source   [tid]);
+		simu->set_module("codec"    , tid, simu->codec    [tid]);
+		simu->set_module("encoder"  , tid, simu->codec    [tid]->get_encoder());
+		simu->set_module("decoder"  , tid, simu->codec    [tid]->get_decoder_siso());
+		simu->set_module("modem"    , tid, simu->modem    [tid]);
+		simu->set_module("modem_a"  , tid, simu->modem_a  [tid]);
+		simu->set_module("channel"  , tid, simu->channel  [tid]);
+		simu->set_module("channel_a", tid, simu->channel_a[tid]);
+
+		simu->monitor[tid]->add_handler_measure(std::bind(&module::Codec_SISO<B,R>::reset, simu->codec[tid].get()));
+
+		if (simu->codec[tid]->get_decoder_siso()->get_n_frames() > 1)
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, "The inter frame is not supported.");
+	}
+	catch (std::exception const& e)
+	{
+		tools::Terminal::stop();
+		simu->simu_error = true;
+
+		simu->mutex_exception.lock();
+
+		auto save = tools::exception::no_backtrace;
+		tools::exception::no_backtrace = true;
+		std::string msg = e.what(); // get only the function signature
+		tools::exception::no_backtrace = save;
+
+		if (std::find(simu->prev_err_messages.begin(), simu->prev_err_messages.end(), msg) ==
+		                                               simu->prev_err_messages.end())
+		{
+			// with backtrace if debug mode
+			rang::format_on_each_line(std::cerr, std::string(e.what()) + "\n", rang::tag::error);
+			// save only the function signature
+			simu->prev_err_messages.push_back(msg);
+		}
+		simu->mutex_exception.unlock();
+	}
+}
 
+template <typename B, typename R>
+void EXIT<B,R>
+::launch()
+{
 	// allocate and build all the communication chain to generate EXIT chart
 	this->build_communication_chain();
-	this->sockets_binding();
 
+	if (tools::Terminal::is_over())
+		return;
+
+	for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+		this->sockets_binding(tid);
 
 	// for each channel NOISE to be simulated
 	for (unsigned noise_idx = 0; noise_idx < params_EXIT.noise->range.size(); noise_idx ++)
@@ -126,9 +196,12 @@ void EXIT<B,R>
 
 		this->noise.set_noise(sigma, ebn0, esn0);
 
-		channel ->set_noise(this->noise);
-		modem   ->set_noise(this->noise);
-		codec   ->set_noise(this->noise);
+		for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+		{
+			channel[tid]->set_noise(this->noise);
+			modem  [tid]->set_noise(this->noise);
+			codec  [tid]->set_noise(this->noise);
+		}
 
 		// for each "a" standard deviation (sig_a) to be simulated
 		using namespace module;
@@ -138,18 +211,21 @@ void EXIT<B,R>
 
 			if (sig_a == 0.f) // if sig_a = 0, La_K2 = 0
 			{
-				auto &mdm = *this->modem_a;
-				if (params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos)
+				for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
 				{
-					auto mdm_data  = (uint8_t*)(mdm[mdm::sck::demodulate_wg::Y_N2].get_dataptr());
-					auto mdm_bytes =            mdm[mdm::sck::demodulate_wg::Y_N2].get_databytes();
-					std::fill(mdm_data, mdm_data + mdm_bytes, 0);
-				}
-				else
-				{
-					auto mdm_data  = (uint8_t*)(mdm[mdm::sck::demodulate::Y_N2].get_dataptr());
-					auto mdm_bytes =            mdm[mdm::sck::demodulate::Y_N2].get_databytes();
-					std::fill(mdm_data, mdm_data + mdm_bytes, 0);
+					auto &mdm = *this->modem_a[tid];
+					if (params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos)
+					{
+						auto mdm_data  = (uint8_t*)(mdm[mdm::sck::demodulate_wg::Y_N2].get_dataptr());
+						auto mdm_bytes =            mdm[mdm::sck::demodulate_wg::Y_N2].get_databytes();
+						std::fill(mdm_data, mdm_data + mdm_bytes, 0);
+					}
+					else
+					{
+						auto mdm_data  = (uint8_t*)(mdm[mdm::sck::demodulate::Y_N2].get_dataptr());
+						auto mdm_bytes =            mdm[mdm::sck::demodulate::Y_N2].get_databytes();
+						std::fill(mdm_data, mdm_data + mdm_bytes, 0);
+					}
 				}
 				this->noise_a.set_noise(std::numeric_limits<R>::infinity());
 			}
@@ -161,8 +237,11 @@ void EXIT<B,R>
 				R sig_a_ebn0 = tools::esn0_to_ebn0 (sig_a_esn0, bit_rate, params_EXIT.mdm->bps);
 
 				this->noise_a.set_noise(sig_a_2, sig_a_ebn0, sig_a_esn0);
-				channel_a->set_noise(this->noise_a);
-				modem_a  ->set_noise(this->noise_a);
+				for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+				{
+					channel_a[tid]->set_noise(this->noise_a);
+					modem_a  [tid]->set_noise(this->noise_a);
+				}
 			}
 
 
@@ -176,8 +255,30 @@ void EXIT<B,R>
 				this->terminal->start_temp_report(params_EXIT.ter->frequency);
 
 
-			this->simulation_loop();
+			// the trials of the current (noise, sig_a) point are shared between the threads
+			std::vector<std::thread> threads(params_EXIT.n_threads -1);
+			for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+				threads[tid -1] = std::thread(EXIT<B,R>::start_thread, this, tid);
+
+			EXIT<B,R>::start_thread(this, 0);
 
+			for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+				threads[tid -1].join();
+
+			this->pinning.unpin();
+
+			// final and full reduction (the extrinsic LLRs of all the threads are taken into account for I_E)
+			module::Monitor_reduction::is_done_all(true, true);
+
+			if (!this->prev_err_messages_to_display.empty())
+			{
+				terminal->final_report(std::cout);
+				rang::format_on_each_line(std::cerr, this->prev_err_messages_to_display.back() + "\n",
+				                          rang::tag::error);
+				this->simu_error = true;
+				tools::Terminal::stop();
+				break;
+			}
 
 			if (!params_EXIT.ter->disabled)
 			{
@@ -203,7 +304,7 @@ void EXIT<B,R>
 				}
 			}
 
-			this->monitor->reset();
+			module::Monitor_reduction::reset_all();
 			for (auto &m : modules)
 				for (auto& mm : m.second)
 					if (mm != nullptr)
@@ -221,17 +322,49 @@ void EXIT<B,R>
 
 template <typename B, typename R>
 void EXIT<B,R>
-::sockets_binding()
+::start_thread(EXIT<B,R> *simu, const int tid)
+{
+	try
+	{
+		simu->pinning.pin(tid);
+		simu->simulation_loop(tid);
+	}
+	catch (std::exception const& e)
+	{
+		tools::Terminal::stop();
+		module::Monitor_reduction::set_stop_loop();
+
+		simu->mutex_exception.lock();
+
+		auto save = tools::exception::no_backtrace;
+		tools::exception::no_backtrace = true;
+		std::string msg = e.what(); // get only the function signature
+		tools::exception::no_backtrace = save;
+
+		if (std::find(simu->prev_err_messages.begin(), simu->prev_err_messages.end(), msg) ==
+		    simu->prev_err_messages.end())
+		{
+			simu->prev_err_messages.push_back(msg); // save only the function signature
+			simu->prev_err_messages_to_display.push_back(e.what()); // with backtrace if debug mode
+		}
+
+		simu->mutex_exception.unlock();
+	}
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::sockets_binding(const int tid)
 {
-	auto &src = *this->source;
-	auto &cdc = *this->codec;
-	auto &enc = *this->codec->get_encoder();
-	auto &dec = *this->codec->get_decoder_siso();
-	auto &mdm = *this->modem;
-	auto &mda = *this->modem_a;
-	auto &chn = *this->channel;
-	auto &cha = *this->channel_a;
-	auto &mnt = *this->monitor;
+	auto &src = *this->source   [tid];
+	auto &cdc = *this->codec    [tid];
+	auto &enc = *this->codec    [tid]->get_encoder();
+	auto &dec = *this->codec    [tid]->get_decoder_siso();
+	auto &mdm = *this->modem    [tid];
+	auto &mda = *this->modem_a  [tid];
+	auto &chn = *this->channel  [tid];
+	auto &cha = *this->channel_a[tid];
+	auto &mnt = *this->monitor  [tid];
 
 	using namespace module;
 
@@ -280,21 +413,21 @@ void EXIT<B,R>
 
 template <typename B, typename R>
 void EXIT<B,R>
-::simulation_loop()
+::simulation_loop(const int tid)
 {
-	auto &source    = *this->source;
-	auto &codec     = *this->codec;
-	auto &encoder   = *this->codec->get_encoder();
-	auto &decoder   = *this->codec->get_decoder_siso();
-	auto &modem     = *this->modem;
-	auto &modem_a   = *this->modem_a;
-	auto &channel   = *this->channel;
-	auto &channel_a = *this->channel_a;
-	auto &monitor   = *this->monitor;
+	auto &source    = *this->source   [tid];
+	auto &codec     = *this->codec    [tid];
+	auto &encoder   = *this->codec    [tid]->get_encoder();
+	auto &decoder   = *this->codec    [tid]->get_decoder_siso();
+	auto &modem     = *this->modem    [tid];
+	auto &modem_a   = *this->modem_a  [tid];
+	auto &channel   = *this->channel  [tid];
+	auto &channel_a = *this->channel_a[tid];
+	auto &monitor   = *this->monitor  [tid];
 
 	using namespace module;
 
-	while (!monitor.n_trials_achieved())
+	while (!tools::Terminal::is_interrupt() && !module::Monitor_reduction::is_done_all())
 	{
 		if (params_EXIT.debug)
 		{
@@ -350,28 +483,30 @@ void EXIT<B,R>
 
 template <typename B, typename R>
 std::unique_ptr<module::Source<B>> EXIT<B,R>
-::build_source()
+::build_source(const int tid)
 {
-	return std::unique_ptr<module::Source<B>>(params_EXIT.src->template build<B>());
+	std::unique_ptr<factory::Source::parameters> src_params(params_EXIT.src->clone());
+	src_params->seed = params_EXIT.src->seed + tid;
+	return std::unique_ptr<module::Source<B>>(src_params->template build<B>());
 }
 
 template <typename B, typename R>
 std::unique_ptr<module::Codec_SISO<B,R>> EXIT<B,R>
-::build_codec()
+::build_codec(const int tid)
 {
 	return std::unique_ptr<module::Codec_SISO<B,R>>(params_EXIT.cdc->template build<B,R>());
 }
 
 template <typename B, typename R>
 std::unique_ptr<module::Modem<B,R,R>> EXIT<B,R>
-::build_modem()
+::build_modem(const int tid)
 {
 	return std::unique_ptr<module::Modem<B,R,R>>(params_EXIT.mdm->template build<B,R>());
 }
 
 template <typename B, typename R>
 std::unique_ptr<module::Modem<B,R>> EXIT<B,R>
-::build_modem_a()
+::build_modem_a(const int tid)
 {
 	std::unique_ptr<factory::Modem::parameters> mdm_params(params_EXIT.mdm->clone());
 	mdm_params->N = params_EXIT.cdc->K;
@@ -380,16 +515,19 @@ std::unique_ptr<module::Modem<B,R>> EXIT<B,R>
 
 template <typename B, typename R>
 std::unique_ptr<module::Channel<R>> EXIT<B,R>
-::build_channel(const int size)
+::build_channel(const int tid)
 {
-	return std::unique_ptr<module::Channel<R>>(params_EXIT.chn->template build<R>());
+	std::unique_ptr<factory::Channel::parameters> chn_params(params_EXIT.chn->clone());
+	chn_params->seed = params_EXIT.chn->seed + tid;
+	return std::unique_ptr<module::Channel<R>>(chn_params->template build<R>());
 }
 
 template <typename B, typename R>
 std::unique_ptr<module::Channel<R>> EXIT<B,R>
-::build_channel_a(const int size)
+::build_channel_a(const int tid)
 {
 	std::unique_ptr<factory::Channel::parameters> chn_params(params_EXIT.chn->clone());
+	chn_params->seed = params_EXIT.chn->seed + tid;
 	chn_params->N   = factory::Modem::get_buffer_size_after_modulation(params_EXIT.mdm->type,
 	                                                                   params_EXIT.cdc->K,
 	                                                                   params_EXIT.mdm->bps,
@@ -401,7 +539,7 @@ std::unique_ptr<module::Channel<R>> EXIT<B,R>
 
 template <typename B, typename R>
 std::unique_ptr<module::Monitor_EXIT<B,R>> EXIT<B,R>
-::build_monitor()
+::build_monitor(const int tid)
 {
 	return std::unique_ptr<module::Monitor_EXIT<B,R>>(params_EXIT.mnt->template build<B,R>());
 }
@@ -410,7 +548,7 @@ template <typename B, typename R>
 std::unique_ptr<tools::Terminal> EXIT<B,R>
 ::build_terminal()
 {
-	return std::unique_ptr<tools::Terminal>(params_EXIT.ter->build(this->reporters));
+	return std::unique_ptr<tools::Terminal>(params_EXIT.ter->build(this->reporters, &this->modules));
 }
 
 // ==================================================================================== explicit template instantiation
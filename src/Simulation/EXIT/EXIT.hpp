@@ -3,11 +3,14 @@
 #ifndef SIMULATION_EXIT_HPP_
 #define SIMULATION_EXIT_HPP_
 
+#include <mutex>
 #include <vector>
 #include <memory>
+#include <string>
 
 #include "Tools/Display/Terminal/Terminal.hpp"
 #include "Tools/Noise/Sigma.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
 #include "Tools/Display/Reporter/Reporter.hpp"
 #include "Module/Source/Source.hpp"
 #include "Module/Codec/Codec_SISO.hpp"
@@ -15,6 +18,7 @@
 #include "Module/Channel/Channel.hpp"
 #include "Module/Decoder/Decoder_SISO.hpp"
 #include "Module/Monitor/EXIT/Monitor_EXIT.hpp"
+#include "Module/Monitor/Monitor_reduction.hpp"
 
 #include "Factory/Simulation/EXIT/EXIT.hpp"
 
@@ -35,15 +39,27 @@ protected:
 	tools::Sigma<R>  noise_a; // current noise simulated for the "a" part
 	R sig_a;
 
-	// communication chain
-	std::unique_ptr<module::Source      <B  >> source;
-	std::unique_ptr<module::Codec_SISO  <B,R>> codec;
-	std::unique_ptr<module::Modem       <B,R>> modem;
-	std::unique_ptr<module::Modem       <B,R>> modem_a;
-	std::unique_ptr<module::Channel     <  R>> channel;
-	std::unique_ptr<module::Channel     <  R>> channel_a;
-	std::unique_ptr<module::Decoder_SISO<  R>> siso;
-	std::unique_ptr<module::Monitor_EXIT<B,R>> monitor;
+	// placement of the threads on the CPUs (and on the NUMA nodes)
+	const tools::Thread_pinning pinning;
+
+	std::mutex               mutex_exception;
+	std::vector<std::string> prev_err_messages;
+	std::vector<std::string> prev_err_messages_to_display;
+
+	// communication chain (one per thread)
+	std::vector<std::unique_ptr<module::Source      <B  >>> source;
+	std::vector<std::unique_ptr<module::Codec_SISO  <B,R>>> codec;
+	std::vector<std::unique_ptr<module::Modem       <B,R>>> modem;
+	std::vector<std::unique_ptr<module::Modem       <B,R>>> modem_a;
+	std::vector<std::unique_ptr<module::Channel     <  R>>> channel;
+	std::vector<std::unique_ptr<module::Channel     <  R>>> channel_a;
+
+	// the monitors of the EXIT simulation (one per thread and the reduction of them)
+	using Monitor_EXIT_type           = module::Monitor_EXIT<B,R>;
+	using Monitor_EXIT_reduction_type = module::Monitor_reduction_M<Monitor_EXIT_type>;
+
+	std::vector<std::unique_ptr<Monitor_EXIT_type          >> monitor;
+	            std::unique_ptr<Monitor_EXIT_reduction_type>  monitor_red;
 
 	// terminal and reporters (for the output of the code)
 	std::vector<std::unique_ptr<tools::Reporter>> reporters;
@@ -57,17 +73,21 @@ public:
 
 protected:
 	void _build_communication_chain();
-	void sockets_binding           ();
-	void simulation_loop           ();
-
-	std::unique_ptr<module::Source      <B  >> build_source   (              );
-	std::unique_ptr<module::Codec_SISO  <B,R>> build_codec    (              );
-	std::unique_ptr<module::Modem       <B,R>> build_modem    (              );
-	std::unique_ptr<module::Modem       <B,R>> build_modem_a  (              );
-	std::unique_ptr<module::Channel     <  R>> build_channel  (const int size);
-	std::unique_ptr<module::Channel     <  R>> build_channel_a(const int size);
-	std::unique_ptr<module::Monitor_EXIT<B,R>> build_monitor  (              );
-	std::unique_ptr<tools::Terminal          > build_terminal (              );
+	void sockets_binding           (const int tid = 0);
+	void simulation_loop           (const int tid = 0);
+
+	std::unique_ptr<module::Source      <B  >> build_source   (const int tid = 0);
+	std::unique_ptr<module::Codec_SISO  <B,R>> build_codec    (const int tid = 0);
+	std::unique_ptr<module::Modem       <B,R>> build_modem    (const int tid = 0);
+	std::unique_ptr<module::Modem       <B,R>> build_modem_a  (const int tid = 0);
+	std::unique_ptr<module::Channel     <  R>> build_channel  (const int tid = 0);
+	std::unique_ptr<module::Channel     <  R>> build_channel_a(const int tid = 0);
+	std::unique_ptr<module::Monitor_EXIT<B,R>> build_monitor  (const int tid = 0);
+	std::unique_ptr<tools::Terminal          > build_terminal (                 );
+
+private:
+	static void start_thread_build_comm_chain(EXIT<B,R> *simu, const int tid);
+	static void start_thread                 (EXIT<B,R> *simu, const int tid);
 };
 }
 }
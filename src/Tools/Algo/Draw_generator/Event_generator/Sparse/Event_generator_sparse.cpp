@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Tools/Algo/Draw_generator/Event_generator/Sparse/Event_generator_sparse.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+template <typename R, typename E>
+Event_generator_sparse<R,E>
+::Event_generator_sparse(const int seed, const R dense_threshold)
+: Event_generator<R,E>(), dense_generator(seed), dense_threshold(dense_threshold)
+{
+	this->set_seed(seed);
+}
+
+template <typename R, typename E>
+void Event_generator_sparse<R,E>
+::set_seed(const int seed)
+{
+	mt19937.seed(seed);
+	dense_generator.set_seed(seed);
+}
+
+template <typename R, typename E>
+bool Event_generator_sparse<R,E>
+::is_sparse(const R event_probability) const
+{
+	return event_probability < this->dense_threshold;
+}
+
+template <typename R, typename E>
+R Event_generator_sparse<R,E>
+::get_dense_threshold() const
+{
+	return this->dense_threshold;
+}
+
+template <typename R, typename E>
+const std::vector<unsigned>& Event_generator_sparse<R,E>
+::generate_positions(const unsigned length, const R event_probability)
+{
+	positions.clear();
+
+	if (event_probability <= (R)0. || length == 0)
+		return positions;
+
+	if (event_probability >= (R)1.)
+	{
+		positions.resize(length);
+		for (unsigned i = 0; i < length; i++)
+			positions[i] = i;
+		return positions;
+	}
+
+	// the number of non-events before an event follows a geometric distribution:
+	// gap = floor(log(u) / log(1 - p)) with u uniformly drawn in ]0,1[
+	const auto inv_log_q = 1.0 / std::log1p(-(double)event_probability);
+
+	positions.reserve((size_t)((double)length * (double)event_probability * 1.5) + 8);
+
+	unsigned pos = 0;
+	while (true)
+	{
+		const auto gap = std::floor(std::log(mt19937.randd_oo()) * inv_log_q);
+		if (gap >= (double)(length - pos))
+			break;
+
+		pos += (unsigned)gap;
+		positions.push_back(pos++);
+
+		if (pos >= length)
+			break;
+	}
+
+	return positions;
+}
+
+template <typename R, typename E>
+void Event_generator_sparse<R,E>
+::generate(E *draw, const unsigned length, const R event_probability)
+{
+	if (!this->is_sparse(event_probability))
+	{
+		dense_generator.generate(draw, length, event_probability);
+	}
+	else
+	{
+		std::fill(draw, draw + length, (E)false);
+		for (auto p : this->generate_positions(length, event_probability))
+			draw[p] = (E)true;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::tools::Event_generator_sparse<R_32>;
+template class aff3ct::tools::Event_generator_sparse<R_64>;
+#else
+template class aff3ct::tools::Event_generator_sparse<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,60 @@
+#ifndef EVENT_GENERATOR_SPARSE_HPP
+#define EVENT_GENERATOR_SPARSE_HPP
+
+#include <vector>
+
+#include "Tools/types.h"
+#include "Tools/Algo/PRNG/PRNG_MT19937.hpp"
+#include "Tools/Algo/Draw_generator/Event_generator/Event_generator.hpp"
+#include "Tools/Algo/Draw_generator/Event_generator/Fast/Event_generator_fast.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Event_generator_sparse
+ *
+ * \brief Generate Bernoulli events by drawing the gaps between two consecutive events from a geometric distribution.
+ *
+ * Only one random number is drawn per event instead of one per element: this is much faster than the other
+ * generators when the event probability is low. When the event probability is higher than the 'dense_threshold',
+ * the generation falls back on the SIMD fast generator.
+ */
+template <typename R = float, typename E = typename tools::matching_types<R>::B>
+class Event_generator_sparse : public Event_generator<R,E>
+{
+private:
+	tools::PRNG_MT19937       mt19937;         // Mersenne Twister 19937 (scalar), used to draw the gaps
+	Event_generator_fast<R,E> dense_generator; // SIMD generator, used when the events are dense
+	const R                   dense_threshold; // event probability above which the dense generator is used
+	std::vector<unsigned>     positions;       // positions of the last generated events
+
+public:
+	explicit Event_generator_sparse(const int seed = 0, const R dense_threshold = (R)0.02);
+
+	virtual ~Event_generator_sparse() = default;
+
+	virtual void set_seed(const int seed);
+
+	virtual void generate(E *draw, const unsigned length, const R event_probability);
+
+	/*!
+	 * \brief Return true if the events are generated from geometric gaps for the given probability.
+	 */
+	bool is_sparse(const R event_probability) const;
+
+	/*!
+	 * \brief Generate the sorted positions of the events in a frame of 'length' elements.
+	 *
+	 * \return the positions of the events (valid until the next call to a generate method).
+	 */
+	const std::vector<unsigned>& generate_positions(const unsigned length, const R event_probability);
+
+	R get_dense_threshold() const;
+};
+
+}
+}
+
+#endif //EVENT_GENERATOR_SPARSE_HPP
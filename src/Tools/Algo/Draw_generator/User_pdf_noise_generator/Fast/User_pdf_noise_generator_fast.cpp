@@ -92,7 +92,7 @@ template <>
 void User_pdf_noise_generator_fast<float>
 ::generate(const float* signal, float *draw, const unsigned length, const float noise_power)
 {
-	auto dis = this->distributions.get_distribution(noise_power);
+	const auto& dis = this->distributions.get_distribution(noise_power);
 
 	const unsigned vec_loop_size = (length / mipp::N<float>()) * mipp::N<float>();
 
@@ -106,11 +106,17 @@ void User_pdf_noise_generator_fast<float>
 		draw[i] = get_random();
 
 
+	const float*    cdf_y  [2] = {dis.get_cdf_y    ()[0].data(), dis.get_cdf_y    ()[1].data()};
+	const float*    cdf_x  [2] = {dis.get_cdf_x    ()[0].data(), dis.get_cdf_x    ()[1].data()};
+	const unsigned* guide  [2] = {dis.get_cdf_guide()[0].data(), dis.get_cdf_guide()[1].data()};
+	const unsigned  l_cdf  [2] = {(unsigned)dis.get_cdf_x    ()[0].size(), (unsigned)dis.get_cdf_x    ()[1].size()};
+	const unsigned  l_guide[2] = {(unsigned)dis.get_cdf_guide()[0].size(), (unsigned)dis.get_cdf_guide()[1].size()};
+
+	// the guide tables make the CDF inversion O(1) per sample instead of a binary search
 	for (unsigned i = 0; i < length; i++)
 	{
-		const auto& cdf_y = signal[i] ? dis.get_cdf_y()[1] : dis.get_cdf_y()[0];
-		const auto& cdf_x = signal[i] ? dis.get_cdf_x()[1] : dis.get_cdf_x()[0];
-		draw[i] = interp_function(cdf_y.data(), cdf_x.data(), (unsigned)cdf_x.size(), draw[i]);
+		const auto b = signal[i] ? 1 : 0;
+		draw[i] = interp_function(cdf_y[b], cdf_x[b], l_cdf[b], guide[b], l_guide[b], draw[i]);
 	}
 }
 }
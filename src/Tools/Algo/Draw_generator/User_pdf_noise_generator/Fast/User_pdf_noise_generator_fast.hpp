@@ -18,7 +18,7 @@ private:
 	tools::PRNG_MT19937      mt19937;      // Mersenne Twister 19937 (scalar)
 	tools::PRNG_MT19937_simd mt19937_simd; // Mersenne Twister 19937 (SIMD)
 
-	R (*interp_function)(const R*, const R*, const unsigned, const R);
+	R (*interp_function)(const R*, const R*, const unsigned, const unsigned*, const unsigned, const R);
 
 public:
 	explicit User_pdf_noise_generator_fast(const tools::Distributions<R>& dists, const int seed = 0, Interpolation_type inter_type = Interpolation_type::NEAREST);
@@ -46,14 +46,15 @@ template <typename R>
 void User_pdf_noise_generator_GSL<R>
 ::generate(const R* signal, R *draw, const unsigned length, const R noise_power)
 {
-	auto dis = this->distributions.get_distribution(noise_power);
+	const auto& dis = this->distributions.get_distribution(noise_power);
 
 	for (unsigned i = 0; i < length; i++)
 	{
 		const auto& cdf_y = signal[i] ? dis.get_cdf_y()[1] : dis.get_cdf_y()[0];
 		const auto& cdf_x = signal[i] ? dis.get_cdf_x()[1] : dis.get_cdf_x()[0];
+		const auto& guide = signal[i] ? dis.get_cdf_guide()[1] : dis.get_cdf_guide()[0];
 		const auto uni_draw = gsl_ran_flat((gsl_rng*)rng, (R)0, (R)1);
-		draw[i] = interp_function(cdf_y.data(), cdf_x.data(), cdf_x.size(), uni_draw);
+		draw[i] = interp_function(cdf_y.data(), cdf_x.data(), (unsigned)cdf_x.size(), guide.data(), (unsigned)guide.size(), uni_draw);
 	}
 }
 
@@ -17,7 +17,7 @@ class User_pdf_noise_generator_GSL : public User_pdf_noise_generator<R>
 private:
 	void* rng; // gsl_rng* type
 
-	R (*interp_function)(const R*, const R*, const unsigned, const R);
+	R (*interp_function)(const R*, const R*, const unsigned, const unsigned*, const unsigned, const R);
 
 public:
 	explicit User_pdf_noise_generator_GSL(const tools::Distributions<R>& dists, const int seed = 0, Interpolation_type inter_type = Interpolation_type::NEAREST);
@@ -55,7 +55,7 @@ template <typename R>
 void User_pdf_noise_generator_MKL<R>
 ::generate(const R* signal, R *draw, const unsigned length, const R noise_power)
 {
-	auto dis = this->distributions.get_distribution(noise_power);
+	const auto& dis = this->distributions.get_distribution(noise_power);
 
 	vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD, *(VSLStreamStatePtr*)stream_state, length, draw, (R)0, (R)1);
 
@@ -64,7 +64,8 @@ void User_pdf_noise_generator_MKL<R>
 	{
 		const auto& cdf_y = signal[i] ? dis.get_cdf_y()[1] : dis.get_cdf_y()[0];
 		const auto& cdf_x = signal[i] ? dis.get_cdf_x()[1] : dis.get_cdf_x()[0];
-		draw[i] = interp_function(cdf_y.data(), cdf_x.data(), cdf_x.size(), draw[i]);
+		const auto& guide = signal[i] ? dis.get_cdf_guide()[1] : dis.get_cdf_guide()[0];
+		draw[i] = interp_function(cdf_y.data(), cdf_x.data(), (unsigned)cdf_x.size(), guide.data(), (unsigned)guide.size(), draw[i]);
 	}
 }
 
@@ -79,7 +80,7 @@ template <>
 void User_pdf_noise_generator_MKL<double>
 ::generate(const double* signal, double *draw, const unsigned length, const double noise_power)
 {
-	auto dis = this->distributions.get_distribution(noise_power);
+	const auto& dis = this->distributions.get_distribution(noise_power);
 
 	vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD, *(VSLStreamStatePtr*)stream_state, length, draw, (double)0, (double)1);
 
@@ -88,7 +89,8 @@ void User_pdf_noise_generator_MKL<double>
 	{
 		const auto& cdf_y = signal[i] ? dis.get_cdf_y()[1] : dis.get_cdf_y()[0];
 		const auto& cdf_x = signal[i] ? dis.get_cdf_x()[1] : dis.get_cdf_x()[0];
-		draw[i] = interp_function(cdf_y.data(), cdf_x.data(), cdf_x.size(), draw[i]);
+		const auto& guide = signal[i] ? dis.get_cdf_guide()[1] : dis.get_cdf_guide()[0];
+		draw[i] = interp_function(cdf_y.data(), cdf_x.data(), (unsigned)cdf_x.size(), guide.data(), (unsigned)guide.size(), draw[i]);
 	}
 }
 }
@@ -18,7 +18,7 @@ private:
 	void* stream_state;
 	bool  is_stream_alloc;
 
-	R (*interp_function)(const R*, const R*, const unsigned, const R);
+	R (*interp_function)(const R*, const R*, const unsigned, const unsigned*, const unsigned, const R);
 
 public:
 	explicit User_pdf_noise_generator_MKL(const tools::Distributions<R>& dists, const int seed = 0, Interpolation_type inter_type = Interpolation_type::NEAREST);
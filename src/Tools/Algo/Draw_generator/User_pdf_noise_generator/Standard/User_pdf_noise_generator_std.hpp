@@ -18,7 +18,7 @@ private:
 	std::mt19937                      rd_engine; // Mersenne Twister 19937
 	std::uniform_real_distribution<R> uniform_dist;
 
-	R (*interp_function)(const R*, const R*, const unsigned, const R);
+	R (*interp_function)(const R*, const R*, const unsigned, const unsigned*, const unsigned, const R);
 
 public:
 	explicit User_pdf_noise_generator_std(const tools::Distributions<R>& dists, const int seed = 0, Interpolation_type inter_type = Interpolation_type::NEAREST);
@@ -91,6 +91,11 @@ public:
 
 	inline size_t get_n_values() const;
 
+	/*
+	 * the calibrated values (see 'calibrate_val') and their number of occurrences
+	 */
+	inline const std::map<int, size_t>& get_hist() const;
+
 private:
 	inline int dump_all_values(std::ofstream& hist_file, R hist_min, R hist_max) const;
 
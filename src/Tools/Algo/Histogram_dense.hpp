@@ -0,0 +1,79 @@
+#ifndef HISTOGRAM_DENSE_HPP__
+#define HISTOGRAM_DENSE_HPP__
+
+#include <fstream>
+#include <cstddef>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+
+/*
+ * Histogram of integer values in a fixed range [0, n_bins[ stored in a dense array: adding a value is O(1) and two
+ * histograms are merged with a simple element-wise sum. The values out of the range are counted in an overflow bucket.
+ */
+class Histogram_dense
+{
+protected:
+	std::vector<size_t> hist;          // hist[v] is the number of occurrences of the value 'v'
+	size_t              overflow  = 0; // number of occurrences of the values out of [0, n_bins[
+	size_t              n_values  = 0;
+	int                 max_value = -1; // the highest value in [0, n_bins[ added in the histogram, -1 if none
+
+public:
+	/*
+	 * @n_bins the number of values in the range of the histogram: [0, n_bins[
+	 */
+	inline explicit Histogram_dense(const size_t n_bins = 0);
+
+	~Histogram_dense() = default;
+
+	/*
+	 * Extend the range of the histogram to [0, n_bins[, the histogram never shrinks.
+	 */
+	inline void resize(const size_t n_bins);
+
+	inline void add_values(const Histogram_dense& other);
+
+	inline void add_value(const int v);
+
+	/*
+	 *	Add a value 'v' 'weight' times in the histogram
+	 */
+	inline void add_value(const int v, const size_t weight);
+
+	/*
+	 * @hist_file is the output stream where will be dump the histogram with one (x,y) couple per line
+	 * @hist_min is the left border of the dump
+	 * @hist_max is the right border of the dump (included)
+	 * @return 1 when there is an error in given limits
+	 */
+	inline int dump(std::ofstream& hist_file, const int hist_min, const int hist_max) const;
+
+	/*
+	 * Reset histogram values but not its range.
+	 */
+	inline void reset();
+
+	inline int get_hist_max() const;
+
+	inline size_t get_n_bins() const;
+
+	inline size_t get_n_values() const;
+
+	inline size_t get_overflow() const;
+
+	/*
+	 * the number of occurrences of each value of the range
+	 */
+	inline const std::vector<size_t>& get_hist() const;
+};
+
+}
+}
+
+#include "Tools/Algo/Histogram_dense.hxx"
+
+#endif // HISTOGRAM_DENSE_HPP__
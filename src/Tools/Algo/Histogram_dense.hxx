@@ -0,0 +1,126 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Histogram_dense.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+
+Histogram_dense
+::Histogram_dense(const size_t n_bins)
+: hist(n_bins, 0)
+{
+}
+
+void Histogram_dense
+::resize(const size_t n_bins)
+{
+	if (n_bins > hist.size())
+		hist.resize(n_bins, 0);
+}
+
+void Histogram_dense
+::add_values(const Histogram_dense& other)
+{
+	this->resize(other.hist.size());
+
+	for (auto v = 0; v <= other.max_value; v++)
+		hist[v] += other.hist[v];
+
+	overflow  += other.overflow;
+	n_values  += other.n_values;
+	max_value  = std::max(max_value, other.max_value);
+}
+
+void Histogram_dense
+::add_value(const int v)
+{
+	if ((size_t)(unsigned)v < hist.size())
+	{
+		hist[v]++;
+		if (v > max_value)
+			max_value = v;
+	}
+	else
+		overflow++;
+
+	n_values++;
+}
+
+void Histogram_dense
+::add_value(const int v, const size_t weight)
+{
+	if ((size_t)(unsigned)v < hist.size())
+	{
+		hist[v] += weight;
+		if (v > max_value && weight)
+			max_value = v;
+	}
+	else
+		overflow += weight;
+
+	n_values += weight;
+}
+
+int Histogram_dense
+::dump(std::ofstream& hist_file, const int hist_min, const int hist_max) const
+{
+	if (hist_min >= hist_max || hist_min < 0)
+		return 1;
+
+	for (auto v = hist_min; v <= hist_max; v++)
+		hist_file << v << "; " << ((size_t)v < hist.size() ? hist[v] : 0) << std::endl;
+
+	return 0;
+}
+
+void Histogram_dense
+::reset()
+{
+	std::fill(hist.begin(), hist.begin() + (max_value +1), 0);
+	overflow  = 0;
+	n_values  = 0;
+	max_value = -1;
+}
+
+int Histogram_dense
+::get_hist_max() const
+{
+	if (max_value < 0)
+	{
+		std::stringstream message;
+		message << "The histogram is empty." << std::endl;
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return max_value;
+}
+
+size_t Histogram_dense
+::get_n_bins() const
+{
+	return hist.size();
+}
+
+size_t Histogram_dense
+::get_n_values() const
+{
+	return n_values;
+}
+
+size_t Histogram_dense
+::get_overflow() const
+{
+	return overflow;
+}
+
+const std::vector<size_t>& Histogram_dense
+::get_hist() const
+{
+	return hist;
+}
+}
+}
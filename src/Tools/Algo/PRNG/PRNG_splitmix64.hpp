@@ -0,0 +1,78 @@
+/*!
+ * \file
+ * \brief The SplitMix64 counter-based pseudo-random number generator (PRNG).
+ *
+ * Each output is a bijective mix of a 64-bit counter: the state update is a single addition and the draws are
+ * inlined, this makes this PRNG well suited for the inner loops (the shuffles for instance).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+
+#ifndef PRNG_SPLITMIX64_HPP
+#define PRNG_SPLITMIX64_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class PRNG_splitmix64
+ * \brief The SplitMix64 counter-based pseudo-random number generator (PRNG).
+ */
+class PRNG_splitmix64
+{
+protected:
+	uint64_t counter;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param seed: a seed to initialize the PRNG.
+	 */
+	explicit inline PRNG_splitmix64(const uint64_t seed = 0);
+
+	/*!
+	 * \brief Initialize the PRNG with given seed value.
+	 *
+	 * \param seed: a seed.
+	 */
+	inline void seed(const uint64_t seed);
+
+	/*!
+	 * \brief Extract a pseudo-random unsigned 64-bit integer in the range 0 ... UINT64_MAX.
+	 *
+	 * \return a pseudo random number.
+	 */
+	inline uint64_t rand_u64();
+
+	/*!
+	 * \brief Extract a pseudo-random unsigned 32-bit integer in the range 0 ... range -1.
+	 *
+	 * The multiply-shift method of Lemire is used: there is no division except in the (rare) rejection case.
+	 *
+	 * \param range: the number of possible values (has to be greater than 0).
+	 *
+	 * \return a pseudo random number.
+	 */
+	inline uint32_t rand_u32(const uint32_t range);
+
+	/*!
+	 * \brief Shuffle the data with the Fisher-Yates algorithm (uniform permutation).
+	 *
+	 * \param data: the data to shuffle.
+	 * \param size: the number of elements in 'data'.
+	 */
+	template <typename T>
+	inline void shuffle(T *data, const size_t size);
+};
+}
+}
+
+#include "Tools/Algo/PRNG/PRNG_splitmix64.hxx"
+
+#endif /* PRNG_SPLITMIX64_HPP */
@@ -0,0 +1,56 @@
+#include <utility>
+
+#include "Tools/Algo/PRNG/PRNG_splitmix64.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+PRNG_splitmix64
+::PRNG_splitmix64(const uint64_t seed)
+: counter(seed)
+{
+}
+
+void PRNG_splitmix64
+::seed(const uint64_t seed)
+{
+	this->counter = seed;
+}
+
+uint64_t PRNG_splitmix64
+::rand_u64()
+{
+	uint64_t z = (this->counter += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+uint32_t PRNG_splitmix64
+::rand_u32(const uint32_t range)
+{
+	uint64_t m = (this->rand_u64() >> 32) * range;
+	uint32_t l = (uint32_t)m;
+	if (l < range)
+	{
+		const uint32_t t = (0u - range) % range;
+		while (l < t)
+		{
+			m = (this->rand_u64() >> 32) * range;
+			l = (uint32_t)m;
+		}
+	}
+
+	return (uint32_t)(m >> 32);
+}
+
+template <typename T>
+void PRNG_splitmix64
+::shuffle(T *data, const size_t size)
+{
+	for (auto i = size; i > 1; i--)
+		std::swap(data[i -1], data[this->rand_u32((uint32_t)i)]);
+}
+}
+}
@@ -25,13 +25,18 @@ bool CRC_checker_DB<B,R>
 		for (auto i = 0; i < (int)apost.size(); i++)
 			apost[i] = sys[i] + ext[i];
 
-		// compute the hard decision (for the CRC)
-		const auto loop_size = (int)s.size();
+		// compute the hard decision (for the CRC), the frames are interleaved with the inter-frame SIMD
+		const auto n_frames  = this->simd_inter_frame_level;
+		const auto loop_size = (int)s.size() / n_frames;
 		for (auto i = 0; i < loop_size; i+=2)
-		{
-			s[i  ] = (std::max(apost[2*i+2], apost[2*i+3]) - std::max(apost[2*i+0], apost[2*i+1])) > 0;
-			s[i+1] = (std::max(apost[2*i+1], apost[2*i+3]) - std::max(apost[2*i+0], apost[2*i+2])) > 0;
-		}
+			for (auto f = 0; f < n_frames; f++)
+			{
+				const auto apost_i = &apost[2 * i * n_frames + f];
+				const R post[4] = {apost_i[0], apost_i[n_frames], apost_i[2 * n_frames], apost_i[3 * n_frames]};
+
+				s[(i  ) * n_frames + f] = (std::max(post[2], post[3]) - std::max(post[0], post[1])) > 0;
+				s[(i+1) * n_frames + f] = (std::max(post[1], post[3]) - std::max(post[0], post[2])) > 0;
+			}
 		return this->crc.check(s, this->simd_inter_frame_level);
 	}
 
@@ -45,7 +45,6 @@ typename Reporter_EXIT<B,R>::report_t Reporter_EXIT<B,R>
 
 	const auto fra   = this->monitor.get_n_trials();
 	const auto I_A   = this->monitor.get_I_A();
-	const auto I_E   = this->monitor.get_I_E();
 
 	std::stringstream str_sig_a, str_fra, str_I_A, str_I_E;
 
@@ -61,7 +60,12 @@ typename Reporter_EXIT<B,R>::report_t Reporter_EXIT<B,R>
 
 	str_fra << std::setprecision(2) << std::fixed << fra;
 	str_I_A << std::setprecision(6) << std::fixed << I_A;
-	str_I_E << std::setprecision(6) << std::fixed << I_E;
+
+	// the extrinsic LLRs are merged by the final reduction only: I_E is unknown in the temporary reports
+	if (final)
+		str_I_E << std::setprecision(6) << std::fixed << this->monitor.get_I_E();
+	else
+		str_I_E << "-";
 
 	EXIT_report.push_back(str_sig_a.str());
 	EXIT_report.push_back(str_fra  .str());
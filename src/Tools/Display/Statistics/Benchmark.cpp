@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+#include <ios>
+
+#include "Module/Module.hpp"
+#include "Module/Socket.hpp"
+#include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Display/Statistics/Benchmark.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Benchmark::Result Benchmark
+::run(module::Task &task, const int n_warmup, const int n_reps)
+{
+	using namespace std::chrono;
+
+	Result result;
+	result.module_name = task.get_module().get_custom_name().empty() ? task.get_module().get_short_name() :
+	                                                                    task.get_module().get_custom_name();
+	result.task_name   = task.get_name();
+	result.n_elmts     = task.sockets.back()->get_n_elmts();
+	result.latencies.resize(n_reps);
+
+	for (auto r = 0; r < n_warmup; r++)
+		task.exec();
+
+	for (auto r = 0; r < n_reps; r++)
+	{
+		auto t_start = steady_clock::now();
+		task.exec();
+		result.latencies[r] = duration_cast<nanoseconds>(steady_clock::now() - t_start);
+	}
+
+	std::sort(result.latencies.begin(), result.latencies.end());
+
+	return result;
+}
+
+std::chrono::nanoseconds Benchmark
+::percentile(const std::vector<std::chrono::nanoseconds> &latencies, const float p)
+{
+	if (latencies.empty())
+		return std::chrono::nanoseconds(0);
+
+	const auto rank = (size_t)std::ceil((p / 100.f) * (float)latencies.size());
+	return latencies[std::min(latencies.size(), std::max((size_t)1, rank)) -1];
+}
+
+void Benchmark
+::separation1(std::ostream &stream)
+{
+	stream << "# " << rang::style::bold << "---------------------------------||---------------------||--------------------------------||------------------------------------------------------" << rang::style::reset << std::endl;
+}
+
+void Benchmark
+::separation2(std::ostream &stream)
+{
+	stream << "# " << rang::style::bold << "-------------|-------------------||----------|----------||----------|----------|----------||----------|----------|----------|----------|----------" << rang::style::reset << std::endl;
+}
+
+void Benchmark
+::show_header(std::ostream &stream)
+{
+	Benchmark::separation1(stream);
+	stream << "# " << rang::style::bold << "  Benchmark for the given task   ||  Basic statistics   ||       Measured throughput      ||                   Measured latency                   " << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << "  (warm-up calls not accounted)  ||     on the task     ||   considering the last socket  ||              considering the last socket             " << rang::style::reset << std::endl;
+	Benchmark::separation1(stream);
+	Benchmark::separation2(stream);
+	stream << "# " << rang::style::bold << "      MODULE |              TASK ||    CALLS |     TIME ||  AVERAGE |   MEDIAN |  MINIMUM ||  MINIMUM |   MEDIAN |      P90 |      P99 |  MAXIMUM " << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << "             |                   ||          |      (s) ||   (Mb/s) |   (Mb/s) |   (Mb/s) ||     (us) |     (us) |     (us) |     (us) |     (us) " << rang::style::reset << std::endl;
+	Benchmark::separation2(stream);
+}
+
+void Benchmark
+::show_result(const Result &result, std::ostream &stream)
+{
+	if (result.latencies.empty())
+		return;
+
+	auto tot_dur = std::chrono::nanoseconds(0);
+	for (auto &l : result.latencies)
+		tot_dur += l;
+
+	const auto n_calls = result.latencies.size();
+	const auto min_dur = result.latencies.front();
+	const auto max_dur = result.latencies.back();
+	const auto p50_dur = Benchmark::percentile(result.latencies, 50.f);
+	const auto p90_dur = Benchmark::percentile(result.latencies, 90.f);
+	const auto p99_dur = Benchmark::percentile(result.latencies, 99.f);
+
+	// the number of elements per microsecond is the number of mega-elements per second
+	auto thr = [&](const std::chrono::nanoseconds d, const size_t n) { return (float)n / ((float)d.count() * 0.001f); };
+	auto lat = [ ](const std::chrono::nanoseconds d) { return (float)d.count() * 0.001f; };
+
+	const std::vector<float> values = {thr(tot_dur, n_calls * result.n_elmts),
+	                                   thr(p50_dur, result.n_elmts),
+	                                   thr(max_dur, result.n_elmts),
+	                                   lat(min_dur),
+	                                   lat(p50_dur),
+	                                   lat(p90_dur),
+	                                   lat(p99_dur),
+	                                   lat(max_dur)};
+
+	const float l2 = 99999.99f;
+
+	std::stringstream ssmodule, ssprocess, ssn_calls, sstot_dur;
+	ssmodule  << std::setw(12) << result.module_name;
+	ssprocess << std::setw(17) << result.task_name;
+	ssn_calls << std::setw( 8) << n_calls;
+	sstot_dur << std::setprecision(2) << std::fixed << std::setw(8) << (float)tot_dur.count() * 0.000000001f;
+
+	stream << "# ";
+	stream << ssmodule .str() << rang::style::bold << " | "  << rang::style::reset
+	       << ssprocess.str() << rang::style::bold << " || " << rang::style::reset
+	       << ssn_calls.str() << rang::style::bold << " | "  << rang::style::reset
+	       << sstot_dur.str();
+
+	for (size_t v = 0; v < values.size(); v++)
+	{
+		std::stringstream ssval;
+		ssval << std::setprecision(2) << (values[v] > l2 ? std::scientific : std::fixed) << std::setw(8) << values[v];
+
+		stream << rang::style::bold << (v == 0 || v == 3 ? " || " : " | ") << rang::style::reset << ssval.str();
+	}
+	stream << std::endl;
+}
+
+void Benchmark
+::show(const std::vector<Result> &results, std::ostream &stream)
+{
+	if (results.empty())
+	{
+		stream << rang::tag::comment << rang::tag::info << "There is no task to benchmark." << std::endl;
+		return;
+	}
+
+	Benchmark::show_header(stream);
+	for (auto &r : results)
+		Benchmark::show_result(r, stream);
+	Benchmark::separation2(stream);
+}
@@ -0,0 +1,59 @@
+#ifndef BENCHMARK_HPP_
+#define BENCHMARK_HPP_
+
+#include <iostream>
+#include <cstddef>
+#include <vector>
+#include <chrono>
+#include <string>
+
+#include "Module/Task.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+class Benchmark
+{
+public:
+	struct Result
+	{
+		std::string                           module_name;
+		std::string                           task_name;
+		size_t                                n_elmts;   // number of elements of the last socket
+		std::vector<std::chrono::nanoseconds> latencies; // sorted latencies of the timed executions
+	};
+
+protected:
+	Benchmark() = default;
+
+public:
+	virtual ~Benchmark() = default;
+
+	/*!
+	 * \brief Executes a task 'n_warmup' times and then times it 'n_reps' times, the data of the sockets are reused
+	 *        from an execution to another.
+	 */
+	static Result run(module::Task &task, const int n_warmup, const int n_reps);
+
+	static void show(const std::vector<Result> &results, std::ostream &stream = std::cout);
+
+	/*!
+	 * \brief Returns the latency at the given percentile (nearest-rank method) of a sorted latency vector.
+	 */
+	static std::chrono::nanoseconds percentile(const std::vector<std::chrono::nanoseconds> &latencies,
+	                                           const float p);
+
+private:
+	static void separation1(std::ostream &stream = std::cout);
+
+	static void separation2(std::ostream &stream = std::cout);
+
+	static void show_header(std::ostream &stream = std::cout);
+
+	static void show_result(const Result &result, std::ostream &stream = std::cout);
+};
+}
+}
+
+#endif /* BENCHMARK_HPP_ */
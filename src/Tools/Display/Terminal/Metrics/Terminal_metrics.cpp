@@ -0,0 +1,331 @@
+#if !defined(_WIN64) && !defined(_WIN32)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <poll.h>
+#endif
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <limits>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Display/Terminal/Metrics/Terminal_metrics.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Terminal_metrics
+::Terminal_metrics(const std::vector<std::unique_ptr<tools::Reporter>>& reporters,
+                   const std::string& json_path,
+                   const std::string& sock_path,
+                   const modules_map_t* modules)
+: Terminal_std(reporters),
+  modules(modules),
+  json_path(json_path),
+  sock_path(sock_path),
+  t_start(std::chrono::steady_clock::now()),
+  point_id(0),
+  sock_fd(-1),
+  stop_server(false)
+{
+	if (!json_path.empty())
+	{
+		json_file.open(json_path, std::ios::out | std::ios::trunc);
+		if (!json_file.is_open())
+		{
+			std::stringstream message;
+			message << "Impossible to open the file ('json_path' = " << json_path << ").";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	if (!sock_path.empty())
+		this->start_server();
+}
+
+Terminal_metrics
+::~Terminal_metrics()
+{
+	this->stop_temp_report(); // the terminal thread may still use the exporter
+	this->stop_server_thread();
+}
+
+void Terminal_metrics
+::report(std::ostream &stream, bool final)
+{
+	// the reporters are called only once per report: they reset their state on the final report
+	auto reports = this->collect_reports(final);
+	this->display_reports(stream, reports, final);
+	this->export_reports (        reports, final);
+}
+
+void Terminal_metrics
+::export_reports(const std::vector<Reporter::report_t> &reports, bool final)
+{
+	const auto et = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+	                                                                      t_start).count() * 1e-6;
+
+	std::stringstream json, prom;
+	json << std::setprecision(std::numeric_limits<double>::digits10 +1);
+	prom << std::setprecision(std::numeric_limits<double>::digits10 +1);
+
+	json << "{\"point\":" << point_id << ",\"final\":" << (final ? "true" : "false") << ",\"time\":" << et
+	     << ",\"metrics\":{";
+
+	bool first = true;
+	for (unsigned r = 0; r < this->reporters.size(); r++)
+	{
+		auto& groups = this->reporters[r]->get_groups();
+		for (unsigned g = 0; g < groups.size(); g++)
+			for (unsigned c = 0; c < groups[g].second.size(); c++)
+			{
+				const auto& name = groups[g].second[c].first;
+				const auto& text = reports[r][g][c];
+
+				double val;
+				const bool is_num = to_number(text, val);
+
+				json << (first ? "" : ",") << json_quote(name) << ":";
+				if (is_num && std::isfinite(val))
+					json << val;
+				else
+					json << json_quote(text);
+				first = false;
+
+				if (is_num)
+					prom << "aff3ct_" << sanitize(name) << "{point=\"" << point_id << "\"} " << val << "\n";
+			}
+	}
+	json << "}";
+
+	if (this->modules != nullptr)
+	{
+		std::stringstream prom_tsk;
+		prom_tsk << std::setprecision(std::numeric_limits<double>::digits10 +1);
+
+		json << ",\"tasks\":[";
+		first = true;
+		for (auto &m : *this->modules)
+		{
+			if (m.second.empty() || m.second[0] == nullptr)
+				continue;
+
+			for (size_t t = 0; t < m.second[0]->tasks.size(); t++)
+			{
+				uint64_t n_calls  = 0;
+				double   duration = 0.; // in seconds
+				for (auto &mod : m.second)
+					if (mod != nullptr && t < mod->tasks.size())
+					{
+						n_calls  += mod->tasks[t]->get_n_calls();
+						duration += (double)mod->tasks[t]->get_duration_total().count() * 1e-9;
+					}
+
+				if (n_calls == 0)
+					continue;
+
+				const auto& tsk_name = m.second[0]->tasks[t]->get_name();
+
+				json << (first ? "" : ",") << "{\"module\":" << json_quote(m.first) << ",\"task\":"
+				     << json_quote(tsk_name) << ",\"calls\":" << n_calls << ",\"duration\":" << duration << "}";
+				first = false;
+
+				const auto labels = "{module=\"" + sanitize(m.first) + "\",task=\"" + sanitize(tsk_name) + "\"}";
+				prom_tsk << "aff3ct_task_calls_total"            << labels << " " << n_calls  << "\n";
+				prom_tsk << "aff3ct_task_duration_seconds_total" << labels << " " << duration << "\n";
+			}
+		}
+		json << "]";
+
+		prom_tasks = prom_tsk.str();
+	}
+	json << "}";
+
+	if (json_file.is_open())
+		json_file << json.str() << std::endl;
+
+	if (!sock_path.empty())
+	{
+		if (prom_points.size() <= point_id)
+			prom_points.resize(point_id +1);
+		prom_points[point_id] = prom.str();
+
+		std::stringstream full;
+		full << "aff3ct_elapsed_seconds " << et << "\n";
+		full << "aff3ct_point " << point_id << "\n";
+		for (auto &p : prom_points)
+			full << p;
+		full << prom_tasks;
+
+		std::lock_guard<std::mutex> lock(mutex_snapshot);
+		snapshot = full.str();
+	}
+
+	if (final)
+		point_id++;
+}
+
+void Terminal_metrics
+::start_server()
+{
+#if !defined(_WIN64) && !defined(_WIN32)
+	struct sockaddr_un addr;
+	if (sock_path.size() >= sizeof(addr.sun_path))
+	{
+		std::stringstream message;
+		message << "'sock_path' is too long ('sock_path.size()' = " << sock_path.size() << ", 'max' = "
+		        << sizeof(addr.sun_path) -1 << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	sock_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sock_fd < 0)
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "Impossible to create the Unix domain socket.");
+
+	std::memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	std::strncpy(addr.sun_path, sock_path.c_str(), sizeof(addr.sun_path) -1);
+
+	::unlink(sock_path.c_str());
+	if (::bind(sock_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || ::listen(sock_fd, 8) < 0)
+	{
+		::close(sock_fd);
+		sock_fd = -1;
+
+		std::stringstream message;
+		message << "Impossible to bind the Unix domain socket ('sock_path' = " << sock_path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	stop_server = false;
+	server_thread = std::thread(Terminal_metrics::start_thread_server, this);
+#else
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, "The metrics socket is not supported on Windows.");
+#endif
+}
+
+void Terminal_metrics
+::stop_server_thread()
+{
+	if (server_thread.joinable())
+	{
+		stop_server = true;
+		server_thread.join();
+	}
+
+#if !defined(_WIN64) && !defined(_WIN32)
+	if (sock_fd >= 0)
+	{
+		::close(sock_fd);
+		::unlink(sock_path.c_str());
+		sock_fd = -1;
+	}
+#endif
+}
+
+void Terminal_metrics
+::start_thread_server(Terminal_metrics *terminal)
+{
+#if !defined(_WIN64) && !defined(_WIN32)
+	struct pollfd pfd;
+	pfd.fd     = terminal->sock_fd;
+	pfd.events = POLLIN;
+
+	while (!terminal->stop_server)
+	{
+		// wake up regularly to check if the server has to be stopped
+		if (::poll(&pfd, 1, 200) <= 0 || !(pfd.revents & POLLIN))
+			continue;
+
+		int client_fd = ::accept(terminal->sock_fd, nullptr, nullptr);
+		if (client_fd < 0)
+			continue;
+
+		// consume the request (its content is ignored, the metrics are always returned)
+		struct pollfd cfd;
+		cfd.fd     = client_fd;
+		cfd.events = POLLIN;
+		char request[1024];
+		if (::poll(&cfd, 1, 100) > 0)
+			(void)::recv(client_fd, request, sizeof(request), 0);
+
+		std::string body;
+		{
+			std::lock_guard<std::mutex> lock(terminal->mutex_snapshot);
+			body = terminal->snapshot;
+		}
+
+		std::stringstream response;
+		response << "HTTP/1.0 200 OK\r\n"
+		         << "Content-Type: text/plain; version=0.0.4\r\n"
+		         << "Content-Length: " << body.size() << "\r\n"
+		         << "\r\n"
+		         << body;
+
+		const auto str = response.str();
+		size_t sent = 0;
+		while (sent < str.size())
+		{
+			auto n = ::send(client_fd, str.data() + sent, str.size() - sent, MSG_NOSIGNAL);
+			if (n <= 0)
+				break;
+			sent += (size_t)n;
+		}
+
+		::close(client_fd);
+	}
+#endif
+}
+
+std::string Terminal_metrics
+::sanitize(const std::string &name)
+{
+	std::string s;
+	for (auto c : name)
+		s += std::isalnum((unsigned char)c) ? (char)std::tolower((unsigned char)c) : '_';
+	return s;
+}
+
+std::string Terminal_metrics
+::json_quote(const std::string &str)
+{
+	std::stringstream s;
+	s << "\"";
+	for (auto c : str)
+	{
+		switch (c)
+		{
+			case '"' : s << "\\\""; break;
+			case '\\': s << "\\\\"; break;
+			case '\n': s << "\\n";  break;
+			case '\t': s << "\\t";  break;
+			default:
+				if ((unsigned char)c < 0x20)
+					s << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c << std::dec;
+				else
+					s << c;
+		}
+	}
+	s << "\"";
+	return s.str();
+}
+
+bool Terminal_metrics
+::to_number(const std::string &str, double &val)
+{
+	auto beg = str.find_first_not_of(' ');
+	auto end = str.find_last_not_of (' ');
+	if (beg == std::string::npos)
+		return false;
+
+	const auto trimmed = str.substr(beg, end - beg +1);
+	char* parse_end = nullptr;
+	val = std::strtod(trimmed.c_str(), &parse_end);
+
+	return parse_end == trimmed.c_str() + trimmed.size();
+}
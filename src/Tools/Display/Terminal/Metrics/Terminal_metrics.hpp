@@ -0,0 +1,101 @@
+/*!
+ * \file
+ * \brief The terminal_metrics display (standard display + machine-readable exports).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef TERMINAL_METRICS_HPP_
+#define TERMINAL_METRICS_HPP_
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <atomic>
+#include <map>
+
+#include "Module/Module.hpp"
+#include "Tools/Display/Reporter/Reporter.hpp"
+#include "Tools/Display/Terminal/Standard/Terminal_std.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Terminal_metrics
+ *
+ * \brief The standard display which also exports each report in a machine-readable way.
+ *
+ * Each temporary and final report is appended as one JSON object per line in a file and/or served in the Prometheus
+ * text format on a Unix domain socket (answered as an HTTP/1.0 response, e.g. `curl --unix-socket <path> http:/`).
+ * The exported values are the ones produced by the reporters for the display: no lock of the simulation threads is
+ * taken.
+ */
+class Terminal_metrics : public Terminal_std
+{
+public:
+	using modules_map_t = std::map<std::string, std::vector<const module::Module*>>;
+
+protected:
+	const modules_map_t* modules;
+	const std::string    json_path;
+	const std::string    sock_path;
+
+	std::ofstream json_file;
+
+	std::chrono::time_point<std::chrono::steady_clock> t_start;
+	unsigned                                           point_id;
+	std::vector<std::string>                           prom_points; // Prometheus samples, one string per noise point
+	std::string                                        prom_tasks;  // Prometheus samples of the task timings
+
+	std::mutex  mutex_snapshot; // protects the snapshot served on the socket (never taken by the simulation threads)
+	std::string snapshot;
+
+	int               sock_fd;
+	std::atomic<bool> stop_server; // set by the simulation thread, polled by the server thread
+	std::thread       server_thread;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param reporters: the reporters to display and to export.
+	 * \param json_path: path to the JSON-lines file (disabled if empty).
+	 * \param sock_path: path to the Unix domain socket serving the Prometheus metrics (disabled if empty).
+	 * \param modules:   the modules of the simulation to export the per-task timings (can be null).
+	 */
+	Terminal_metrics(const std::vector<std::unique_ptr<tools::Reporter>>& reporters,
+	                 const std::string& json_path,
+	                 const std::string& sock_path,
+	                 const modules_map_t* modules = nullptr);
+
+	/*!
+	 * \brief Destructor.
+	 */
+	virtual ~Terminal_metrics();
+
+protected:
+	virtual void report(std::ostream &stream = std::cout, bool final = false);
+
+	void export_reports(const std::vector<Reporter::report_t> &reports, bool final);
+
+private:
+	void start_server();
+	void stop_server_thread();
+
+	static void start_thread_server(Terminal_metrics *terminal);
+
+	static std::string sanitize  (const std::string &name);
+	static std::string json_quote(const std::string &str );
+	static bool        to_number (const std::string &str, double &val);
+};
+}
+}
+
+#endif /* TERMINAL_METRICS_HPP_ */
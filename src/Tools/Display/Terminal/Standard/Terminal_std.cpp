@@ -213,6 +213,28 @@ void Terminal_std
 
 void Terminal_std
 ::report(std::ostream &stream, bool final)
+{
+	auto reports = this->collect_reports(final);
+	this->display_reports(stream, reports, final);
+}
+
+std::vector<Reporter::report_t> Terminal_std
+::collect_reports(bool final)
+{
+	std::vector<Reporter::report_t> reports;
+	reports.reserve(this->reporters.size());
+
+	for (auto& r : this->reporters)
+		if (r != nullptr)
+			reports.push_back(r->report(final));
+		else
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, "'this->reporters' contains null pointer.");
+
+	return reports;
+}
+
+void Terminal_std
+::display_reports(std::ostream &stream, const std::vector<Reporter::report_t> &reports, bool final)
 {
 	std::ios::fmtflags f(stream.flags());
 
@@ -223,45 +245,44 @@ void Terminal_std
 	stream << data_tag;
 
 
+	assert(reports.size() == this->reporters.size());
+
 	for (unsigned r = 0; r < this->reporters.size(); r++)
-		if (this->reporters[r] != nullptr)
+	{
+		auto  report = reports[r]; // copy because the columns are padded for the display
+		auto& groups = this->reporters[r]->get_groups();
+
+		assert(report.size() == groups.size());
+
+		for (unsigned g = 0; g < groups.size(); g++)
 		{
-			auto  report = this->reporters[r]->report(final);
-			auto& groups = this->reporters[r]->get_groups();
+			assert(report[g].size() == groups[g].second.size());
 
-			assert(report.size() == groups.size());
+			stream << report_style << std::string(extra_spaces(groups[g]), ' ') << rang::style::reset;
 
-			for (unsigned g = 0; g < groups.size(); g++)
+			for (unsigned c = 0; c < report[g].size(); c++)
 			{
-				assert(report[g].size() == groups[g].second.size());
+				auto& text = report[g][c];
 
-				stream << report_style << std::string(extra_spaces(groups[g]), ' ') << rang::style::reset;
-
-				for (unsigned c = 0; c < report[g].size(); c++)
+				if (text.size() < column_width)
 				{
-					auto& text = report[g][c];
-
-					if (text.size() < column_width)
-					{
-						text += " ";
-						text.insert(0, column_width - text.size(), ' ');
-					}
-
-					stream << text;
-
-					if (c != (report[g].size() - 1))
-						stream << report_style << col_separator << rang::style::reset;
+					text += " ";
+					text.insert(0, column_width - text.size(), ' ');
 				}
 
-				if (g != (groups.size() - 1))
-					stream << report_style << group_separator << rang::style::reset;
+				stream << text;
+
+				if (c != (report[g].size() - 1))
+					stream << report_style << col_separator << rang::style::reset;
 			}
 
-			if (r != (this->reporters.size() - 1))
+			if (g != (groups.size() - 1))
 				stream << report_style << group_separator << rang::style::reset;
 		}
-		else
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, "'this->reporters' contains null pointer.");
+
+		if (r != (this->reporters.size() - 1))
+			stream << report_style << group_separator << rang::style::reset;
+	}
 
 
 	if (final)
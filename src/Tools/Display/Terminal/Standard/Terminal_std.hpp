@@ -63,6 +63,9 @@ public:
 protected:
 	virtual void report(std::ostream &stream = std::cout, bool final = false);
 
+	std::vector<Reporter::report_t> collect_reports(bool final = false);
+	void display_reports(std::ostream &stream, const std::vector<Reporter::report_t> &reports, bool final = false);
+
 	static unsigned extra_spaces   (const Reporter::title_t& text, const unsigned group_width);
 	static unsigned extra_spaces   (const Reporter::group_t& group);
 	static unsigned get_group_width(const Reporter::group_t& group);
@@ -9,7 +9,7 @@ using namespace aff3ct::tools;
 template <typename T>
 Interleaver_core_ARP_DVB_RCS1<T>
 ::Interleaver_core_ARP_DVB_RCS1(const int size, const int n_frames)
-: Interleaver_core<T>(size, "DVB_RCS1", false, n_frames)
+: Interleaver_core<T>(size, "DVB_RCS1", false, n_frames, true)
 {
 	switch (size)
 	{
@@ -98,26 +98,29 @@ template <typename T>
 void Interleaver_core_ARP_DVB_RCS1<T>
 ::gen_lut(T *lut, const int frame_id)
 {
-	int p = 0;
-	int size = this->get_size();
-	for (auto i = 0; i < size; i++)
+	this->gen_idx(lut, 0, this->get_size(), frame_id);
+}
+
+template <typename T>
+void Interleaver_core_ARP_DVB_RCS1<T>
+::gen_idx(T *idx, const int first, const int n, const int frame_id) const
+{
+	const int size = this->get_size();
+	const int P[4] = {(1                ) % size,
+	                  (size / 2 + p1 +1) % size,
+	                  (p2 +1           ) % size,
+	                  (size / 2 + p3 +1) % size};
+
+	// the product p0 * i is incrementally computed (modulo 'size')
+	const auto step = p0 % size;
+	auto prod = (int)(((long long)p0 * first) % size);
+	for (auto i = 0; i < n; i++)
 	{
-		switch(i%4)
-		{
-			case 0:
-				p = 0;
-				break;
-			case 1:
-				p = size/2 + p1;
-				break;
-			case 2:
-				p = p2;
-				break;
-			case 3:
-				p = size/2 + p3;
-				break;
-		}
-		lut[i] = (p0*i + p + 1) % size;
+		const auto v = prod + P[(first + i) & 3];
+		idx[i] = (T)(v >= size ? v - size : v);
+
+		prod += step;
+		prod -= (prod >= size) ? size : 0;
 	}
 }
 
@@ -32,6 +32,8 @@ public:
 	Interleaver_core_ARP_DVB_RCS1(const int size, const int n_frames = 1);
 	virtual ~Interleaver_core_ARP_DVB_RCS1() = default;
 
+	void gen_idx(T *idx, const int first, const int n, const int frame_id = 0) const;
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 };
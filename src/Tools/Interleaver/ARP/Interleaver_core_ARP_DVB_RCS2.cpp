@@ -9,7 +9,7 @@ using namespace aff3ct::tools;
 template <typename T>
 Interleaver_core_ARP_DVB_RCS2<T>
 ::Interleaver_core_ARP_DVB_RCS2(const int size, const int n_frames)
-: Interleaver_core<T>(size, "DVB_RCS2", false, n_frames)
+: Interleaver_core<T>(size, "DVB_RCS2", false, n_frames, true)
 {
 	switch (size)
 	{
@@ -152,26 +152,29 @@ template <typename T>
 void Interleaver_core_ARP_DVB_RCS2<T>
 ::gen_lut(T *lut, const int frame_id)
 {
-	int q = 0;
-	int size = this->get_size();
-	for (auto i = 0; i < size; i++)
+	this->gen_idx(lut, 0, this->get_size(), frame_id);
+}
+
+template <typename T>
+void Interleaver_core_ARP_DVB_RCS2<T>
+::gen_idx(T *idx, const int first, const int n, const int frame_id) const
+{
+	const int size = this->get_size();
+	const int P[4] = {(3                     ) % size,
+	                  (4 * q1 +3             ) % size,
+	                  (4 * q0 * p + 4 * q2 +3) % size,
+	                  (4 * q0 * p + 4 * q3 +3) % size};
+
+	// the product p * i is incrementally computed (modulo 'size')
+	const auto step = p % size;
+	auto prod = (int)(((long long)p * first) % size);
+	for (auto i = 0; i < n; i++)
 	{
-		switch(i%4)
-		{
-			case 0:
-				q = 0;
-				break;
-			case 1:
-				q = 4*q1;
-				break;
-			case 2:
-				q = 4*q0*p + 4*q2;
-				break;
-			case 3:
-				q = 4*q0*p + 4*q3;
-				break;
-		}
-		lut[i] = (p*i + q + 3) % size;
+		const auto v = prod + P[(first + i) & 3];
+		idx[i] = (T)(v >= size ? v - size : v);
+
+		prod += step;
+		prod -= (prod >= size) ? size : 0;
 	}
 }
 
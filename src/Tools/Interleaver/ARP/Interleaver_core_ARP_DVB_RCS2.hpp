@@ -19,6 +19,8 @@ public:
 	Interleaver_core_ARP_DVB_RCS2(const int size, const int n_frames = 1);
 	virtual ~Interleaver_core_ARP_DVB_RCS2() = default;
 
+	void gen_idx(T *idx, const int first, const int n, const int frame_id = 0) const;
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 };
@@ -10,26 +10,19 @@ using namespace aff3ct::tools;
 template <typename T>
 Interleaver_core_CCSDS<T>
 ::Interleaver_core_CCSDS(const int size, const int n_frames)
-: Interleaver_core<T>(size, "CCSDS", false, n_frames)
+: Interleaver_core<T>(size, "CCSDS", false, n_frames, true), k_1(0), k_2(0)
 {
-}
-
-template <typename T>
-void Interleaver_core_CCSDS<T>
-::gen_lut(T *lut, const int frame_id)
-{
-	std::map<T,T> k_1;
-	std::map<T,T> k_2;
+	std::map<int,int> k_1;
+	std::map<int,int> k_2;
 	k_1[1784] = 8; k_2[1784] = 223 * 1;
 	k_1[3568] = 8; k_2[3568] = 223 * 2;
 	k_1[7136] = 8; k_2[7136] = 223 * 4;
 	k_1[8920] = 8; k_2[8920] = 223 * 5;
 
-	auto size = this->get_size();
 	if (k_1.find(size) != k_1.end())
 	{
-		for (auto i = 0; i < size; i++)
-			lut[i] = (T)pi_CCSDS(i, (int)k_1[size], (int)k_2[size]);
+		this->k_1 = k_1[size];
+		this->k_2 = k_2[size];
 	}
 	else
 	{
@@ -40,6 +33,21 @@ void Interleaver_core_CCSDS<T>
 	}
 }
 
+template <typename T>
+void Interleaver_core_CCSDS<T>
+::gen_lut(T *lut, const int frame_id)
+{
+	this->gen_idx(lut, 0, this->get_size(), frame_id);
+}
+
+template <typename T>
+void Interleaver_core_CCSDS<T>
+::gen_idx(T *idx, const int first, const int n, const int frame_id) const
+{
+	for (auto i = 0; i < n; i++)
+		idx[i] = (T)pi_CCSDS(first + i, k_1, k_2);
+}
+
 template <typename T>
 int Interleaver_core_CCSDS<T>
 ::pi_CCSDS(const int &index, const int &k_1, const int &k_2)
@@ -12,10 +12,15 @@ namespace tools
 template <typename T = uint32_t>
 class Interleaver_core_CCSDS : public Interleaver_core<T>
 {
+private:
+	int k_1, k_2;
+
 public:
 	Interleaver_core_CCSDS(const int size, const int n_frames = 1);
 	virtual ~Interleaver_core_CCSDS() = default;
 
+	void gen_idx(T *idx, const int first, const int n, const int frame_id = 0) const;
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 
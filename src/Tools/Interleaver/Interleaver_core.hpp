@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <string>
 #include <vector>
+#include <mutex>
 
 namespace aff3ct
 {
@@ -18,9 +19,12 @@ protected:
 	const int n_frames;
 	      bool uniform;
 	      bool initialized;
-	std::vector<T> pi;     /*!< Lookup table for the interleaving process :
-	                            the interleaving output position i can be found in the source at the position 'pi[i]' */
-	std::vector<T> pi_inv; /*!< Lookup table for the deinterleaving process */
+	const bool lut_free;   /*!< The permutation is computed on the fly by 'gen_idx' and the LUTs are not stored */
+	mutable std::vector<T> pi;     /*!< Lookup table for the interleaving process :
+	                                    the interleaving output position i can be found in the source at the position
+	                                    'pi[i]' (one LUT per frame if the interleaver is uniform, a single LUT otherwise) */
+	mutable std::vector<T> pi_inv; /*!< Lookup table for the deinterleaving process (same layout as 'pi') */
+	mutable std::once_flag lut_flag;
 
 public:
 	/*!
@@ -29,15 +33,40 @@ public:
 	 * \param size:     number of the data to interleave or to deinterleave.
 	 * \param n_frames: number of frames to process in the Interleaver.
 	 * \param name:     Interleaver's name.
+	 * \param lut_free: the permutation is closed-form and computed by 'gen_idx' instead of being stored in the LUTs.
 	 */
-	Interleaver_core(const int size, const std::string &name, const bool uniform = false, const int n_frames = 1);
+	Interleaver_core(const int size, const std::string &name, const bool uniform = false, const int n_frames = 1,
+	                 const bool lut_free = false);
 
 	virtual ~Interleaver_core() = default;
 
+	/*!
+	 * \brief Gets the interleaving LUT (built on the first call for the LUT-free interleavers).
+	 */
 	const std::vector<T>& get_lut() const;
 
+	/*!
+	 * \brief Gets the deinterleaving LUT (built on the first call for the LUT-free interleavers).
+	 */
 	const std::vector<T>& get_lut_inv() const;
 
+	/*!
+	 * \brief Computes the interleaving positions 'first' to 'first + n -1' of the frame 'frame_id':
+	 *        idx[i] = pi[first +i].
+	 *
+	 * The LUT-free interleavers evaluate their closed-form permutation, the other ones read the LUT.
+	 */
+	virtual void gen_idx(T *idx, const int first, const int n, const int frame_id = 0) const;
+
+	/*!
+	 * \brief Permutes 'size' blocks of 'blk_size' contiguous data with the positions of the frame 'frame_id':
+	 *        out[i] = in[pi[i]] (block-wise), or out[pi[i]] = in[i] if 'inverse'.
+	 *
+	 * The positions are generated by 'gen_idx' in small blocks which stay in the L1 cache.
+	 */
+	template <typename D>
+	void permute_blocks(const D *in, D *out, const int blk_size, const bool inverse, const int frame_id = 0) const;
+
 	int get_size() const;
 
 	int get_n_frames() const;
@@ -46,6 +75,8 @@ public:
 
 	bool is_initialized() const;
 
+	bool is_lut_free() const;
+
 	std::string get_name() const;
 
 	void init();
@@ -54,6 +85,9 @@ public:
 
 protected:
 	virtual void gen_lut(T *lut, const int frame_id) = 0;
+
+private:
+	void build_lut() const;
 };
 }
 }
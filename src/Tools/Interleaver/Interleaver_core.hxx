@@ -10,9 +10,11 @@ namespace tools
 {
 template <typename T>
 Interleaver_core<T>
-::Interleaver_core(const int size, const std::string &name, const bool uniform, const int n_frames)
-: size(size), name(name), n_frames(n_frames), uniform(uniform), initialized(false),
-  pi(size * n_frames, 0), pi_inv(size * n_frames, 0)
+::Interleaver_core(const int size, const std::string &name, const bool uniform, const int n_frames,
+                   const bool lut_free)
+: size(size), name(name), n_frames(n_frames), uniform(uniform), initialized(false), lut_free(lut_free),
+  pi    (lut_free ? 0 : size * (uniform ? n_frames : 1), 0),
+  pi_inv(lut_free ? 0 : size * (uniform ? n_frames : 1), 0)
 {
 	if (size <= 0)
 	{
@@ -28,6 +30,13 @@ Interleaver_core<T>
 		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	if (lut_free && uniform)
+	{
+		std::stringstream message;
+		message << "A LUT-free interleaver cannot be uniform.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	if (name.empty())
 	{
 		std::stringstream message;
@@ -40,6 +49,9 @@ template <typename T>
 const std::vector<T>& Interleaver_core<T>
 ::get_lut() const
 {
+	if (lut_free)
+		std::call_once(lut_flag, &Interleaver_core<T>::build_lut, this);
+
 	return pi;
 }
 
@@ -47,9 +59,65 @@ template <typename T>
 const std::vector<T>& Interleaver_core<T>
 ::get_lut_inv() const
 {
+	if (lut_free)
+		std::call_once(lut_flag, &Interleaver_core<T>::build_lut, this);
+
 	return pi_inv;
 }
 
+template <typename T>
+void Interleaver_core<T>
+::gen_idx(T *idx, const int first, const int n, const int frame_id) const
+{
+	if (first < 0 || n < 0 || first + n > this->size)
+	{
+		std::stringstream message;
+		message << "'first' + 'n' has to be smaller or equal to 'size' ('first' = " << first << ", 'n' = " << n
+		        << ", 'size' = " << this->size << ").";
+		throw out_of_range(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto lut = this->get_lut().data() + (uniform ? (frame_id % n_frames) * size : 0) + first;
+	std::copy(lut, lut + n, idx);
+}
+
+template <typename T>
+template <typename D>
+void Interleaver_core<T>
+::permute_blocks(const D *in, D *out, const int blk_size, const bool inverse, const int frame_id) const
+{
+	constexpr int blk = 256;
+	T idx[blk];
+
+	for (auto i0 = 0; i0 < size; i0 += blk)
+	{
+		const auto n = std::min(blk, size - i0);
+		this->gen_idx(idx, i0, n, frame_id);
+
+		for (auto i = 0; i < n; i++)
+		{
+			const auto off_nat = (i0 + i) * blk_size;
+			const auto off_itl = (int)idx[i] * blk_size;
+			if (inverse)
+				std::copy(in + off_nat, in + off_nat + blk_size, out + off_itl);
+			else
+				std::copy(in + off_itl, in + off_itl + blk_size, out + off_nat);
+		}
+	}
+}
+
+template <typename T>
+void Interleaver_core<T>
+::build_lut() const
+{
+	pi    .resize(size);
+	pi_inv.resize(size);
+
+	this->gen_idx(pi.data(), 0, size, 0);
+	for (auto i = 0; i < size; i++)
+		pi_inv[pi[i]] = i;
+}
+
 template <typename T>
 int Interleaver_core<T>
 ::get_size() const
@@ -78,6 +146,13 @@ bool Interleaver_core<T>
 	return initialized;
 }
 
+template <typename T>
+bool Interleaver_core<T>
+::is_lut_free() const
+{
+	return lut_free;
+}
+
 template <typename T>
 std::string Interleaver_core<T>
 ::get_name() const
@@ -97,10 +172,15 @@ template <typename T>
 void Interleaver_core<T>
 ::refresh()
 {
+	// the permutation is generated on demand
+	if (lut_free)
+		return;
+
 	this->gen_lut(this->pi.data(), 0);
 	for (auto i = 0; i < (int)this->get_size(); i++)
 		this->pi_inv[this->pi[i]] = i;
 
+	// the non-uniform interleavers store a single LUT shared by all the frames
 	if (uniform)
 	{
 		for (auto f = 1; f < this->n_frames; f++)
@@ -113,14 +193,6 @@ void Interleaver_core<T>
 				this->pi_inv[off + this->pi[off +i]] = i;
 		}
 	}
-	else
-	{
-		for (auto f = 1; f < this->n_frames; f++)
-		{
-			std::copy(pi    .data(), pi    .data() + size, pi    .data() + f * size);
-			std::copy(pi_inv.data(), pi_inv.data() + size, pi_inv.data() + f * size);
-		}
-	}
 }
 }
 }
@@ -10,16 +10,10 @@ using namespace aff3ct::tools;
 template <typename T>
 Interleaver_core_LTE<T>
 ::Interleaver_core_LTE(const int size, const int n_frames)
-: Interleaver_core<T>(size, "LTE", false, n_frames)
+: Interleaver_core<T>(size, "LTE", false, n_frames, true), f_1(0), f_2(0)
 {
-}
-
-template <typename T>
-void Interleaver_core_LTE<T>
-::gen_lut(T *lut, const int frame_id)
-{
-	std::map<T,T> f_1;
-	std::map<T,T> f_2;
+	std::map<int,int> f_1;
+	std::map<int,int> f_2;
 	f_1[  40] =   3; f_2[  40] =  10;
 	f_1[  48] =   7; f_2[  48] =  12;
 	f_1[  56] =  19; f_2[  56] =  42;
@@ -209,11 +203,10 @@ void Interleaver_core_LTE<T>
 	f_1[6080] =  47; f_2[6080] = 190;
 	f_1[6144] = 263; f_2[6144] = 480;
 
-	auto size = (int)this->get_size();
 	if (f_1.find(size) != f_1.end())
 	{
-		for (auto i = 0; i < size; i++)
-			lut[i] = (T)pi_LTE(i, (int)f_1[size], (int)f_2[size], size);
+		this->f_1 = f_1[size];
+		this->f_2 = f_2[size];
 	}
 	else
 	{
@@ -223,6 +216,44 @@ void Interleaver_core_LTE<T>
 	}
 }
 
+template <typename T>
+void Interleaver_core_LTE<T>
+::gen_lut(T *lut, const int frame_id)
+{
+	this->gen_idx(lut, 0, this->get_size(), frame_id);
+}
+
+template <typename T>
+void Interleaver_core_LTE<T>
+::gen_idx(T *idx, const int first, const int n, const int frame_id) const
+{
+	// the QPP is evaluated with additions only, on L independent lanes (auto-vectorized):
+	// pi(i + L) = pi(i) + d(i) and d(i + L) = d(i) + 2 * f_2 * L^2 (mod K)
+	constexpr int L = 16;
+	const auto K = this->get_size();
+	const auto c = (int)((2ll * f_2 * L * L) % K);
+
+	int p[L], d[L];
+	for (auto l = 0; l < L; l++)
+	{
+		const auto i = (long long)(first + l);
+		p[l] = pi_LTE(first + l, f_1, f_2, K);
+		d[l] = (int)(((long long)f_1 * L + (long long)f_2 * L * L + 2ll * f_2 * L * i) % K);
+	}
+
+	auto i = 0;
+	for (; i <= n - L; i += L)
+		for (auto l = 0; l < L; l++)
+		{
+			idx[i + l] = (T)p[l];
+			p[l] += d[l]; p[l] -= (p[l] >= K) ? K : 0;
+			d[l] += c;    d[l] -= (d[l] >= K) ? K : 0;
+		}
+
+	for (auto l = 0; i < n; i++, l++)
+		idx[i] = (T)p[l];
+}
+
 template <typename T>
 int Interleaver_core_LTE<T>
 ::pi_LTE(const int &i, const int &f_1, const int &f_2, const int &K)
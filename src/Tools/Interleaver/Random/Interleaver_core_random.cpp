@@ -9,7 +9,7 @@ using namespace aff3ct::tools;
 template <typename T>
 Interleaver_core_random<T>
 ::Interleaver_core_random(const int size, const int seed, const bool uniform, const int n_frames)
-: Interleaver_core<T>(size, "random", uniform, n_frames), rd_engine()
+: Interleaver_core<T>(size, "random", uniform, n_frames), rd_engine(), rd_engine_uni(seed)
 {
 	rd_engine.seed(seed);
 }
@@ -18,8 +18,12 @@ template <typename T>
 void Interleaver_core_random<T>
 ::gen_lut(T *lut, const int frame_id)
 {
-	std::iota   (lut, lut + this->get_size(), 0);
-	std::shuffle(lut, lut + this->get_size(), rd_engine);
+	std::iota(lut, lut + this->get_size(), 0);
+
+	if (this->is_uniform())
+		rd_engine_uni.shuffle(lut, (size_t)this->get_size());
+	else
+		std::shuffle(lut, lut + this->get_size(), rd_engine);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <random>
 
+#include "Tools/Algo/PRNG/PRNG_splitmix64.hpp"
 #include "Tools/Interleaver/Interleaver_core.hpp"
 
 namespace aff3ct
@@ -14,7 +15,8 @@ template <typename T = uint32_t>
 class Interleaver_core_random : public Interleaver_core<T>
 {
 private:
-	std::mt19937 rd_engine;
+	std::mt19937    rd_engine;
+	PRNG_splitmix64 rd_engine_uni; // counter-based PRNG, much faster to regenerate the uniform interleavers
 
 public:
 	Interleaver_core_random(const int size, const int seed = 0, const bool uniform = false, const int n_frames = 1);
@@ -1,6 +1,6 @@
 #include <algorithm>
+#include <numeric>
 #include <sstream>
-#include <vector>
 
 #include "Tools/Interleaver/Random_column/Interleaver_core_random_column.hpp"
 
@@ -12,7 +12,7 @@ Interleaver_core_random_column<T>
 ::Interleaver_core_random_column(const int size, const int n_cols, const int seed, const bool uniform,
                                  const int n_frames)
 : Interleaver_core<T>(size, "random_column", uniform, n_frames),
-  rd_engine(), n_cols(n_cols), col_size(size / n_cols)
+  rd_engine(), rd_engine_uni(seed), n_cols(n_cols), col_size(size / n_cols)
 {
 	if (col_size * n_cols != size)
 	{
@@ -29,17 +29,16 @@ template <typename T>
 void Interleaver_core_random_column<T>
 ::gen_lut(T *lut, const int frame_id)
 {
-	std::vector<T> pi_temp(col_size); // interleaver lookup table for a column
-
+	// each column is shuffled in place
 	for (auto column = 0; column < n_cols; column++)
 	{
-		for (auto c = 0; c < col_size; c++)
-			pi_temp[c] = c + column * col_size;
-
-		std::shuffle(pi_temp.begin(), pi_temp.end(), rd_engine);
+		const auto col = lut + column * col_size;
+		std::iota(col, col + col_size, (T)(column * col_size));
 
-		for (auto c = 0; c < col_size; c++)
-			lut[c + column * col_size] = pi_temp[c];
+		if (this->is_uniform())
+			rd_engine_uni.shuffle(col, (size_t)col_size);
+		else
+			std::shuffle(col, col + col_size, rd_engine);
 	}
 }
 
@@ -89,6 +89,22 @@ void Distribution<R>
 			compute_cdf_interpolation();
 			break;
 	}
+
+	compute_cdf_guide();
+}
+
+template <typename R>
+void Distribution<R>
+::compute_cdf_guide()
+{
+	// one guide entry per CDF point gives an expected number of comparisons lower than 2 per search
+	this->cdf_guide.resize(this->cdf_y.size());
+	for (unsigned k = 0; k < this->cdf_y.size(); k++)
+	{
+		this->cdf_guide[k].resize(std::max((size_t)1, this->cdf_y[k].size()));
+		build_guide_table(this->cdf_y[k].data(), (unsigned)this->cdf_y[k].size(),
+		                  this->cdf_guide[k].data(), (unsigned)this->cdf_guide[k].size());
+	}
 }
 
 template <typename R>
@@ -221,6 +237,13 @@ const std::vector<std::vector<R>>& Distribution<R>
 	return this->pdf_norm_y;
 }
 
+template <typename R>
+const std::vector<std::vector<unsigned>>& Distribution<R>
+::get_cdf_guide() const
+{
+	return this->cdf_guide;
+}
+
 
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
@@ -22,6 +22,8 @@ protected:
 	std::vector<std::vector<R>> cdf_x; // cumulative density function as x
 	std::vector<std::vector<R>> cdf_y; // cumulative density function as y
 
+	std::vector<std::vector<unsigned>> cdf_guide; // guide tables to quickly find a value in cdf_y
+
 public:
 	Distribution(const std::vector<R>&  _x_data, const std::vector<R>&               _y_data, Distribution_mode mode = Distribution_mode::SUMMATION);
 	Distribution(      std::vector<R>&& _x_data,       std::vector<R>&&              _y_data, Distribution_mode mode = Distribution_mode::SUMMATION);
@@ -36,10 +38,13 @@ public:
 	const std::vector<std::vector<R>>& get_cdf_y     () const;
 	const std::vector<std::vector<R>>& get_pdf_norm_y() const;
 
+	const std::vector<std::vector<unsigned>>& get_cdf_guide() const;
+
 protected:
 	void compute_cdf(Distribution_mode mode);
 	void compute_cdf_interpolation();
 	void compute_cdf_summation();
+	void compute_cdf_guide();
 };
 
 }
@@ -0,0 +1,157 @@
+/*!
+ * \file
+ * \brief Arithmetic kernels on GF(2^m) shared by the BCH and RS encoders and decoders.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef GALOIS_KERNELS_HPP_
+#define GALOIS_KERNELS_HPP_
+
+#include <cstdint>
+#include <vector>
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \brief Multiplies two elements of GF(2^m) (polynomial form).
+ *
+ * \param alpha_to: the log table of GF(2^m) ('alpha_to.size()' = 2^m).
+ * \param index_of: the antilog table of GF(2^m).
+ */
+template <typename S, typename I>
+inline S gf_mul(const S a, const S b, const std::vector<I> &alpha_to, const std::vector<I> &index_of);
+
+/*!
+ * \brief Divides two elements of GF(2^m) (polynomial form), 'b' has to be non-zero.
+ */
+template <typename S, typename I>
+inline S gf_div(const S a, const S b, const std::vector<I> &alpha_to, const std::vector<I> &index_of);
+
+/*!
+ * \class Galois_linear_map
+ *
+ * \brief A GF(2)-linear map of GF(2^m) (multiplication by a constant, squaring) in polynomial form.
+ *
+ * The map is defined by the images of the m elements alpha^b of the basis. On scalars, it is applied with one lookup
+ * per byte of the input in split tables (256 entries per byte, a single lookup up to m = 8), on SIMD registers it is
+ * bit-sliced: one masked XOR per bit of the input.
+ */
+template <typename S>
+class Galois_linear_map
+{
+protected:
+	int            m;      // order of the Galois Field
+	std::vector<S> images; // images of the alpha^b (b < m)
+	std::vector<S> tab;    // XOR of the images of the bits set in each byte value (256 entries per byte)
+
+public:
+	Galois_linear_map();
+
+	/*!
+	 * \brief The multiplication by alpha^e.
+	 *
+	 * \param alpha_to: the log table of GF(2^m).
+	 * \param e:        the exponent of alpha (index form), -1 is the multiplication by zero.
+	 */
+	template <typename I>
+	static Galois_linear_map<S> mul(const std::vector<I> &alpha_to, const int e);
+
+	/*!
+	 * \brief The squaring (Frobenius map).
+	 *
+	 * \param alpha_to: the log table of GF(2^m).
+	 */
+	template <typename I>
+	static Galois_linear_map<S> square(const std::vector<I> &alpha_to);
+
+	inline S            apply(const S             x  ) const;
+	inline mipp::Reg<S> apply(const mipp::Reg<S> &r_x) const;
+
+protected:
+	template <typename I>
+	Galois_linear_map(const std::vector<I> &alpha_to, const std::vector<int> &images_idx);
+};
+
+/*!
+ * \brief Computes the syndromes s_i = Y(alpha^i), i = 1..'n_synd', of a vector of symbols with the Horner scheme.
+ *
+ * \param Y:       the symbols (polynomial form), the coefficient of x^j is Y[j].
+ * \param N:       the number of symbols.
+ * \param mul_a_i: the multiplications by alpha^i, 'mul_a_i[i]' (i = 1..'n_synd') is used for 's[i]'.
+ * \param n_synd:  the number of syndromes.
+ * \param s:       the syndromes (polynomial form) stored from 's[1]' to 's[n_synd]'.
+ *
+ * \return true if at least one syndrome is not null.
+ */
+template <typename S, typename T>
+inline bool gf_syndromes(const S *Y, const int N, const std::vector<Galois_linear_map<S>> &mul_a_i,
+                         const int n_synd, T *s);
+
+/*!
+ * \brief Computes the syndromes of mipp::N<S>() vectors of symbols at once (one vector per SIMD lane).
+ *
+ * \return a mask set for the lanes with at least one non-null syndrome.
+ */
+template <typename S>
+inline mipp::Msk<mipp::N<S>()> gf_syndromes(const mipp::Reg<S> *Y, const int N,
+                                            const std::vector<Galois_linear_map<S>> &mul_a_i, const int n_synd,
+                                            mipp::Reg<S> *s);
+
+/*!
+ * \brief Computes the syndromes s_i = Y(alpha^i), i = 1..'n_synd', of a binary vector.
+ *
+ * Only the odd syndromes are evaluated on the positions of the bits set, the even ones are s_2i = (s_i)^2.
+ *
+ * \param Y:        the bits, the coefficient of x^j is Y[j] != 0.
+ * \param N:        the number of bits.
+ * \param alpha_to: the log table of GF(2^m).
+ * \param index_of: the antilog table of GF(2^m).
+ * \param n_synd:   the number of syndromes.
+ * \param s:        the syndromes (polynomial form) stored from 's[1]' to 's[n_synd]'.
+ * \param pos:      a buffer of size 'N' to store the positions of the bits set.
+ *
+ * \return true if at least one syndrome is not null.
+ */
+template <typename B, typename I, typename S>
+inline bool gf2_syndromes(const B *Y, const int N, const std::vector<I> &alpha_to, const std::vector<I> &index_of,
+                          const int n_synd, S *s, int *pos);
+
+/*!
+ * \class GF2_lfsr
+ *
+ * \brief Computes the remainder x^n_rdncy U(x) mod g(x) over GF(2) (parity bits of a systematic cyclic code) with a
+ *        bit-packed LFSR: one step shifts and XORs 64 bits of state at once.
+ */
+class GF2_lfsr
+{
+protected:
+	const int             n_rdncy; // degree of g(x)
+	const int             n_words; // number of 64-bit words of the state
+	std::vector<uint64_t> g_w;     // bit-packed coefficients of g(x) (without x^n_rdncy)
+	std::vector<uint64_t> state;
+
+public:
+	/*!
+	 * \param g: the coefficients of the generator polynomial ('g.size()' > 'n_rdncy').
+	 */
+	template <typename I>
+	GF2_lfsr(const std::vector<I> &g, const int n_rdncy);
+
+	/*!
+	 * \param U_K: the information bits, the coefficient of x^k is U_K[k].
+	 * \param K:   the number of information bits.
+	 * \param par: the 'n_rdncy' parity bits.
+	 */
+	template <typename B>
+	inline void remainder(const B *U_K, const int K, B *par);
+};
+}
+}
+
+#include "Tools/Math/Galois_kernels.hxx"
+
+#endif /* GALOIS_KERNELS_HPP_ */
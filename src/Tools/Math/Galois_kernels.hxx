@@ -0,0 +1,229 @@
+#include <algorithm>
+
+#include "Tools/Math/Galois_kernels.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename S, typename I>
+S gf_mul(const S a, const S b, const std::vector<I> &alpha_to, const std::vector<I> &index_of)
+{
+	const auto N = (int)alpha_to.size() -1;
+	if (!a || !b)
+		return (S)0;
+
+	auto e = (int)index_of[(int)a & N] + (int)index_of[(int)b & N];
+	if (e >= N) e -= N;
+	return (S)alpha_to[e];
+}
+
+template <typename S, typename I>
+S gf_div(const S a, const S b, const std::vector<I> &alpha_to, const std::vector<I> &index_of)
+{
+	const auto N = (int)alpha_to.size() -1;
+	if (!a)
+		return (S)0;
+
+	auto e = (int)index_of[(int)a & N] - (int)index_of[(int)b & N];
+	if (e < 0) e += N;
+	return (S)alpha_to[e];
+}
+
+template <typename S>
+Galois_linear_map<S>
+::Galois_linear_map()
+: m(0)
+{
+}
+
+template <typename S>
+template <typename I>
+Galois_linear_map<S>
+::Galois_linear_map(const std::vector<I> &alpha_to, const std::vector<int> &images_idx)
+: m((int)images_idx.size()), images(m), tab(((m + 7) / 8) * 256, (S)0)
+{
+	for (auto b = 0; b < m; b++)
+		this->images[b] = images_idx[b] == -1 ? (S)0 : (S)alpha_to[images_idx[b]];
+
+	for (auto k = 0; k < (m + 7) / 8; k++)
+		for (auto v = 1; v < 256; v++)
+		{
+			// the entry of 'v' is the entry of 'v' without its lowest bit set plus the image of this bit
+			auto c = 0;
+			while (!((v >> c) & 1))
+				c++;
+			const auto image = 8 * k + c < m ? this->images[8 * k + c] : (S)0;
+			this->tab[k * 256 + v] = this->tab[k * 256 + (v & (v -1))] ^ image;
+		}
+}
+
+template <typename S>
+template <typename I>
+Galois_linear_map<S> Galois_linear_map<S>
+::mul(const std::vector<I> &alpha_to, const int e)
+{
+	const auto N = (int)alpha_to.size() -1;
+	auto m = 0;
+	while ((1 << m) < (int)alpha_to.size())
+		m++;
+
+	std::vector<int> images_idx(m);
+	for (auto b = 0; b < m; b++)
+		images_idx[b] = e == -1 ? -1 : (b + e) % N;
+
+	return Galois_linear_map<S>(alpha_to, images_idx);
+}
+
+template <typename S>
+template <typename I>
+Galois_linear_map<S> Galois_linear_map<S>
+::square(const std::vector<I> &alpha_to)
+{
+	const auto N = (int)alpha_to.size() -1;
+	auto m = 0;
+	while ((1 << m) < (int)alpha_to.size())
+		m++;
+
+	std::vector<int> images_idx(m);
+	for (auto b = 0; b < m; b++)
+		images_idx[b] = (2 * b) % N;
+
+	return Galois_linear_map<S>(alpha_to, images_idx);
+}
+
+template <typename S>
+S Galois_linear_map<S>
+::apply(const S x) const
+{
+	if (this->m <= 8)
+		return this->tab[(int)x & 0xFF];
+	if (this->m <= 16)
+		return this->tab[(int)x & 0xFF] ^ this->tab[256 + (((int)x >> 8) & 0xFF)];
+
+	S res = (S)0;
+	for (auto k = 0; k < (this->m + 7) / 8; k++)
+		res ^= this->tab[k * 256 + (((int)x >> (8 * k)) & 0xFF)];
+	return res;
+}
+
+template <typename S>
+mipp::Reg<S> Galois_linear_map<S>
+::apply(const mipp::Reg<S> &r_x) const
+{
+	const auto r_zero = mipp::Reg<S>((S)0);
+
+	auto r_res = r_zero;
+	for (auto b = 0; b < this->m; b++)
+	{
+		const auto m_bit = (r_x & mipp::Reg<S>((S)(1 << b))) != r_zero;
+		r_res ^= mipp::blend(mipp::Reg<S>(this->images[b]), r_zero, m_bit);
+	}
+	return r_res;
+}
+
+template <typename S, typename T>
+bool gf_syndromes(const S *Y, const int N, const std::vector<Galois_linear_map<S>> &mul_a_i, const int n_synd, T *s)
+{
+	// the Horner schemes of the syndromes are interleaved to break the dependency chain of each one
+	for (auto i = 1; i <= n_synd; i++)
+		s[i] = (T)Y[N -1];
+
+	for (auto j = N -2; j >= 0; j--)
+		for (auto i = 1; i <= n_synd; i++)
+			s[i] = (T)(mul_a_i[i].apply((S)s[i]) ^ Y[j]);
+
+	auto syn_error = false;
+	for (auto i = 1; i <= n_synd; i++)
+		syn_error |= s[i] != (T)0;
+
+	return syn_error;
+}
+
+template <typename S>
+mipp::Msk<mipp::N<S>()> gf_syndromes(const mipp::Reg<S> *Y, const int N,
+                                     const std::vector<Galois_linear_map<S>> &mul_a_i, const int n_synd,
+                                     mipp::Reg<S> *s)
+{
+	const auto r_zero = mipp::Reg<S>((S)0);
+
+	auto syn_error = r_zero != r_zero; // init to false
+	for (auto i = 1; i <= n_synd; i++)
+	{
+		const auto &mul = mul_a_i[i];
+
+		auto r_acc = Y[N -1];
+		for (auto j = N -2; j >= 0; j--)
+			r_acc = mul.apply(r_acc) ^ Y[j];
+
+		s[i] = r_acc;
+		syn_error |= r_acc != r_zero;
+	}
+
+	return syn_error;
+}
+
+template <typename B, typename I, typename S>
+bool gf2_syndromes(const B *Y, const int N, const std::vector<I> &alpha_to, const std::vector<I> &index_of,
+                   const int n_synd, S *s, int *pos)
+{
+	const auto N_gf = (int)alpha_to.size() -1;
+
+	auto w = 0;
+	for (auto j = 0; j < N; j++)
+		if (Y[j])
+			pos[w++] = j;
+
+	auto syn_error = false;
+	for (auto i = 1; i <= n_synd; i += 2)
+	{
+		S acc = (S)0;
+		for (auto p = 0; p < w; p++)
+			acc ^= (S)alpha_to[(i * pos[p]) % N_gf];
+
+		s[i] = acc;
+		syn_error |= acc != (S)0;
+	}
+
+	// in GF(2^m), Y(alpha^2i) = Y(alpha^i)^2 for a binary Y
+	for (auto i = 2; i <= n_synd; i += 2)
+		s[i] = gf_mul(s[i / 2], s[i / 2], alpha_to, index_of);
+
+	return syn_error;
+}
+
+template <typename I>
+GF2_lfsr
+::GF2_lfsr(const std::vector<I> &g, const int n_rdncy)
+: n_rdncy(n_rdncy), n_words((n_rdncy + 63) / 64), g_w(n_words, 0), state(n_words, 0)
+{
+	for (auto j = 0; j < n_rdncy; j++)
+		if (g[j])
+			this->g_w[j / 64] |= (uint64_t)1 << (j % 64);
+}
+
+template <typename B>
+void GF2_lfsr
+::remainder(const B *U_K, const int K, B *par)
+{
+	const auto top_w = (this->n_rdncy -1) / 64;
+	const auto top_b = (this->n_rdncy -1) % 64;
+
+	std::fill(this->state.begin(), this->state.end(), (uint64_t)0);
+
+	for (auto i = K -1; i >= 0; i--)
+	{
+		const auto feedback = (uint64_t)(U_K[i] != 0) ^ ((this->state[top_w] >> top_b) & 1);
+		const auto mask     = (uint64_t)0 - feedback;
+
+		// the bits above 'n_rdncy' are never read back, there is no need to clear them
+		for (auto w = this->n_words -1; w > 0; w--)
+			this->state[w] = ((this->state[w] << 1) | (this->state[w -1] >> 63)) ^ (this->g_w[w] & mask);
+		this->state[0] = (this->state[0] << 1) ^ (this->g_w[0] & mask);
+	}
+
+	for (auto j = 0; j < this->n_rdncy; j++)
+		par[j] = (B)((this->state[j / 64] >> (j % 64)) & 1);
+}
+}
+}
@@ -39,6 +39,15 @@ template <typename T>
 void linear_interpolation(const std::vector<T>& x_data, const std::vector<T>& y_data,
                           const std::vector<T>& x_vals,       std::vector<T>& y_vals);
 
+/*
+ * Same as the scalar linear interpolation but the search of x_val in x_data starts from the guide table 'guide' of
+ * length 'l_guide' (see 'build_guide_table'), x_data values must be in the [0,1] range (a CDF for instance).
+ * The expected search cost is O(1) instead of O(log(l_data)).
+ */
+template <typename T>
+T linear_interpolation(const T* x_data, const T* y_data, const unsigned l_data,
+                       const unsigned* guide, const unsigned l_guide, const T x_val);
+
 
 
 
@@ -70,6 +79,34 @@ void nearest_interpolation(const T* x_data, const T* y_data, const unsigned l_da
 template <typename T>
 void nearest_interpolation(const std::vector<T>& x_data, const std::vector<T>& y_data,
                            const std::vector<T>& x_vals,       std::vector<T>& y_vals);
+
+/*
+ * Same as the scalar nearest interpolation but the search of x_val in x_data starts from the guide table 'guide' of
+ * length 'l_guide' (see 'build_guide_table'), x_data values must be in the [0,1] range (a CDF for instance).
+ * The expected search cost is O(1) instead of O(log(l_data)).
+ */
+template <typename T>
+T nearest_interpolation(const T* x_data, const T* y_data, const unsigned l_data,
+                        const unsigned* guide, const unsigned l_guide, const T x_val);
+
+
+
+
+//****************************************************************************************************** GUIDE TABLE
+/*
+ * Build the guide table 'guide' of length 'l_guide' of the sorted x_data array (of length l_data) which values are in
+ * the [0,1] range: guide[j] is the index of the first x that is above or equal to j/l_guide.
+ */
+template <typename T>
+void build_guide_table(const T* x_data, const unsigned l_data, unsigned* guide, const unsigned l_guide);
+
+/*
+ * Return the index of the first x in x_data that is above or equal to x_val (same as std::lower_bound) by starting
+ * the search from the guide table.
+ */
+template <typename T>
+unsigned guided_lower_bound(const T* x_data, const unsigned l_data, const unsigned* guide, const unsigned l_guide,
+                            const T x_val);
 }
 }
 
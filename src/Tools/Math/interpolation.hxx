@@ -16,11 +16,9 @@ namespace tools
 //************************************************************************************************* LINEAR INTERPOLATION
 
 template <typename T>
-T linear_interpolation(const T* x_data, const T* y_data, const unsigned l_data, const T x_val)
+inline T _linear_interpolation(const T* x_data, const T* y_data, const unsigned l_data, const T* x_above,
+                               const T x_val)
 {
-	auto x_above = std::lower_bound(x_data, x_data + l_data, x_val); // find the position of the first x that is above
-	                                                                 // or equal to the x_val
-
 	auto y_above = y_data + (x_above - x_data); // get the position of the matching value y of x_above
 
 	if (x_above == x_data || comp_equal(x_val, *x_above)) // if first or x_above == x_val
@@ -36,6 +34,24 @@ T linear_interpolation(const T* x_data, const T* y_data, const unsigned l_data,
 	return *y_below + (*y_above - *y_below) * (x_val - *x_below) / (*x_above - *x_below);
 }
 
+template <typename T>
+T linear_interpolation(const T* x_data, const T* y_data, const unsigned l_data, const T x_val)
+{
+	auto x_above = std::lower_bound(x_data, x_data + l_data, x_val); // find the position of the first x that is above
+	                                                                 // or equal to the x_val
+
+	return _linear_interpolation(x_data, y_data, l_data, x_above, x_val);
+}
+
+template <typename T>
+T linear_interpolation(const T* x_data, const T* y_data, const unsigned l_data,
+                       const unsigned* guide, const unsigned l_guide, const T x_val)
+{
+	auto x_above = x_data + guided_lower_bound(x_data, l_data, guide, l_guide, x_val);
+
+	return _linear_interpolation(x_data, y_data, l_data, x_above, x_val);
+}
+
 template <typename T>
 void linear_interpolation(const T* x_data, const T* y_data, const unsigned l_data,
                           const T* x_vals,       T* y_vals, const unsigned l_vals)
@@ -63,6 +79,18 @@ T nearest_interpolation(const T* x_data, const T* y_data, const unsigned l_data,
 	return y_data[pos];
 }
 
+template <typename T>
+T nearest_interpolation(const T* x_data, const T* y_data, const unsigned l_data,
+                        const unsigned* guide, const unsigned l_guide, const T x_val)
+{
+	auto pos = guided_lower_bound(x_data, l_data, guide, l_guide, x_val);
+
+	if (pos != 0 && (pos == l_data || (x_data[pos] - x_val) >= (x_val - x_data[pos -1])))
+		pos--; // same choice as 'get_closest'
+
+	return y_data[pos];
+}
+
 template <typename T>
 void nearest_interpolation(const T* x_data, const T* y_data, const unsigned l_data,
                            const T* x_vals,       T* y_vals, const unsigned l_vals)
@@ -82,6 +110,34 @@ void nearest_interpolation(const std::vector<T>& x_data, const std::vector<T>& y
 		y_vals[j] = nearest_interpolation(x_data.data(), y_data.data(), x_data.size(), x_vals[j]);
 }
 
+//****************************************************************************************************** GUIDE TABLE
+template <typename T>
+void build_guide_table(const T* x_data, const unsigned l_data, unsigned* guide, const unsigned l_guide)
+{
+	unsigned i = 0;
+	for (unsigned j = 0; j < l_guide; j++)
+	{
+		const T lim = (T)j / (T)l_guide;
+		while (i < l_data && x_data[i] < lim)
+			i++;
+		guide[j] = i;
+	}
+}
+
+template <typename T>
+unsigned guided_lower_bound(const T* x_data, const unsigned l_data, const unsigned* guide, const unsigned l_guide,
+                            const T x_val)
+{
+	int j = (int)(x_val * (T)l_guide);
+	j = j < 0 ? 0 : (j >= (int)l_guide ? (int)l_guide -1 : j);
+
+	auto i = guide[j];
+	while (i < l_data && x_data[i] < x_val)
+		i++;
+
+	return i;
+}
+
 }
 }
 
@@ -0,0 +1,289 @@
+#if defined(__linux__) || defined(__linux)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#include <sched.h>
+#include <dirent.h>
+#include <cstring>
+#include <cstdio>
+#define AFF3CT_THREAD_PINNING
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <map>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+#ifdef AFF3CT_THREAD_PINNING
+static bool read_int(const std::string &path, int &val)
+{
+	std::ifstream file(path);
+	return (bool)(file >> val);
+}
+
+// parse a sysfs CPU list (ex: "0-3,8,10-11")
+static std::vector<int> read_cpu_list(const std::string &path)
+{
+	std::vector<int> list;
+
+	std::ifstream file(path);
+	std::string line;
+	if (!std::getline(file, line))
+		return list;
+
+	std::stringstream ss(line);
+	std::string range;
+	while (std::getline(ss, range, ','))
+	{
+		if (range.empty())
+			continue;
+
+		const auto dash = range.find('-');
+		const auto first = std::stoi(range.substr(0, dash));
+		const auto last  = dash == std::string::npos ? first : std::stoi(range.substr(dash +1));
+		for (auto c = first; c <= last; c++)
+			list.push_back(c);
+	}
+
+	return list;
+}
+#endif
+
+Thread_pinning
+::Thread_pinning(const int n_threads, const std::string &policy, const std::vector<int> &cpu_list,
+                 const bool no_smt)
+: n_threads(n_threads), policy(policy)
+{
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (policy != "NO" && policy != "COMPACT" && policy != "SCATTER" && policy != "LIST")
+	{
+		std::stringstream message;
+		message << "Unknown pinning policy ('policy' = " << policy << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (policy == "LIST" && cpu_list.empty())
+	{
+		std::stringstream message;
+		message << "'cpu_list' can't be empty with the 'LIST' pinning policy.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (policy == "NO")
+		return;
+
+	this->read_topology();
+
+	std::vector<int> candidates; // indexes in 'cpus'
+	for (auto c = 0; c < (int)this->cpus.size(); c++)
+		if (!no_smt || this->cpus[c].smt == 0)
+			candidates.push_back(c);
+
+	std::vector<int> order;
+	if (policy == "COMPACT")
+	{
+		// the hardware threads of a core, then the cores of a node, are consecutive
+		order = candidates;
+		std::stable_sort(order.begin(), order.end(), [&](const int a, const int b)
+		{
+			const auto &ca = this->cpus[a], &cb = this->cpus[b];
+			if (ca.node != cb.node) return ca.node < cb.node;
+			if (ca.core != cb.core) return ca.core < cb.core;
+			return ca.smt < cb.smt;
+		});
+	}
+	else if (policy == "SCATTER")
+	{
+		// in each node, fill the physical cores before their sibling hardware threads
+		std::map<int, std::vector<int>> per_node;
+		for (auto c : candidates)
+			per_node[this->cpus[c].node].push_back(c);
+
+		for (auto &n : per_node)
+			std::stable_sort(n.second.begin(), n.second.end(), [&](const int a, const int b)
+			{
+				const auto &ca = this->cpus[a], &cb = this->cpus[b];
+				if (ca.smt != cb.smt) return ca.smt < cb.smt;
+				return ca.core < cb.core;
+			});
+
+		for (size_t r = 0; order.size() < candidates.size(); r++)
+			for (auto &n : per_node)
+				if (r < n.second.size())
+					order.push_back(n.second[r]);
+	}
+	else // policy == "LIST"
+	{
+		for (auto id : cpu_list)
+		{
+			auto it = std::find_if(candidates.begin(), candidates.end(), [&](const int c)
+			                       { return this->cpus[c].id == id; });
+			if (it == candidates.end())
+			{
+				std::stringstream message;
+				message << "The CPU " << id << " is not available for pinning ('no_smt' = " << std::boolalpha
+				        << no_smt << ").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+			order.push_back(*it);
+		}
+	}
+
+	if (order.empty())
+	{
+		std::stringstream message;
+		message << "There is no CPU available for pinning.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->thread_cpu.resize(n_threads);
+	for (auto tid = 0; tid < n_threads; tid++)
+		this->thread_cpu[tid] = order[tid % order.size()];
+}
+
+void Thread_pinning
+::read_topology()
+{
+	this->cpus.clear();
+
+#ifdef AFF3CT_THREAD_PINNING
+	const std::string sys_cpu  = "/sys/devices/system/cpu/";
+	const std::string sys_node = "/sys/devices/system/node/";
+
+	cpu_set_t allowed;
+	CPU_ZERO(&allowed);
+	const auto has_allowed = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+	this->affinity.clear();
+	if (has_allowed)
+		for (auto id = 0; id < CPU_SETSIZE; id++)
+			if (CPU_ISSET(id, &allowed))
+				this->affinity.push_back(id);
+
+	std::map<int,int> cpu_node;
+	if (auto dir = opendir(sys_node.c_str()))
+	{
+		while (auto entry = readdir(dir))
+		{
+			int node;
+			if (std::strncmp(entry->d_name, "node", 4) || std::sscanf(entry->d_name + 4, "%d", &node) != 1)
+				continue;
+			for (auto c : read_cpu_list(sys_node + entry->d_name + "/cpulist"))
+				cpu_node[c] = node;
+		}
+		closedir(dir);
+	}
+
+	std::map<std::pair<int,int>,int> core_smt; // number of hardware threads already found per (package, core)
+	std::map<std::pair<int,int>,int> core_ids;
+	for (auto id : read_cpu_list(sys_cpu + "online"))
+	{
+		if (has_allowed && !CPU_ISSET(id, &allowed))
+			continue;
+
+		int core = id, package = 0;
+		read_int(sys_cpu + "cpu" + std::to_string(id) + "/topology/core_id",             core   );
+		read_int(sys_cpu + "cpu" + std::to_string(id) + "/topology/physical_package_id", package);
+
+		const auto key = std::make_pair(package, core);
+		if (!core_ids.count(key))
+			core_ids[key] = (int)core_ids.size();
+
+		CPU cpu;
+		cpu.id   = id;
+		cpu.core = core_ids[key];
+		cpu.node = cpu_node.count(id) ? cpu_node[id] : 0;
+		cpu.smt  = core_smt[key]++;
+		this->cpus.push_back(cpu);
+	}
+#endif
+
+	if (this->cpus.empty())
+	{
+		const auto n_cpus = std::max(1, (int)std::thread::hardware_concurrency());
+		for (auto id = 0; id < n_cpus; id++)
+			this->cpus.push_back({id, id, 0, 0});
+	}
+}
+
+void Thread_pinning
+::pin(const int tid) const
+{
+	if (!this->is_enabled())
+		return;
+
+#ifdef AFF3CT_THREAD_PINNING
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	CPU_SET(this->get_cpu(tid), &cpuset);
+
+	const auto err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+	if (err)
+	{
+		std::stringstream message;
+		message << "'pthread_setaffinity_np' failed ('tid' = " << tid << ", 'cpu' = " << this->get_cpu(tid)
+		        << ", 'errno' = " << strerror(err) << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+#endif
+}
+
+void Thread_pinning
+::unpin() const
+{
+	if (!this->is_enabled() || this->affinity.empty())
+		return;
+
+#ifdef AFF3CT_THREAD_PINNING
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	for (auto id : this->affinity)
+		CPU_SET(id, &cpuset);
+
+	const auto err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+	if (err)
+	{
+		std::stringstream message;
+		message << "'pthread_setaffinity_np' failed ('errno' = " << strerror(err) << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+#endif
+}
+
+bool Thread_pinning
+::is_enabled() const
+{
+#ifdef AFF3CT_THREAD_PINNING
+	return !this->thread_cpu.empty();
+#else
+	return false;
+#endif
+}
+
+int Thread_pinning
+::get_cpu(const int tid) const
+{
+	if (tid < 0 || tid >= this->n_threads)
+	{
+		std::stringstream message;
+		message << "'tid' has to be positive and smaller than 'n_threads' ('tid' = " << tid
+		        << ", 'n_threads' = " << this->n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return this->thread_cpu.empty() ? -1 : this->cpus[this->thread_cpu[tid]].id;
+}
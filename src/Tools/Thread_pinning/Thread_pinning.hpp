@@ -0,0 +1,90 @@
+/*!
+ * \file
+ * \brief Pins the simulation threads on the CPUs following a placement policy.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef THREAD_PINNING_HPP_
+#define THREAD_PINNING_HPP_
+
+#include <string>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Thread_pinning
+ *
+ * \brief Maps the thread ids of a simulation on the CPUs of the machine and binds the calling threads on them.
+ *
+ * The topology (CPUs, cores, packages and NUMA nodes) is read from the Linux sysfs, on the other systems or if sysfs
+ * is not available all the CPUs are considered as different cores of a single node and the pinning is disabled.
+ *
+ * The policies are:
+ *   - "NO":      the threads are not pinned,
+ *   - "COMPACT": the thread tid + 1 is on the same core, else on the same node, than the thread tid,
+ *   - "SCATTER": the consecutive threads are spread in round-robin on the NUMA nodes,
+ *   - "LIST":    the thread tid is pinned on the CPU 'cpu_list[tid % cpu_list.size()]'.
+ * If there are more threads than available CPUs, the threads wrap around the CPUs.
+ */
+class Thread_pinning
+{
+protected:
+	struct CPU
+	{
+		int id;   // logical CPU id (as seen by the OS)
+		int core; // physical core id (unique over the packages)
+		int node; // NUMA node id
+		int smt;  // rank of the CPU among the hardware threads of its core
+	};
+
+	const int              n_threads;
+	const std::string      policy;
+	std::vector<CPU>       cpus;        // the topology of the machine (CPUs ordered by id)
+	std::vector<int>       thread_cpu;  // the CPU of each thread (index in 'cpus')
+	std::vector<int>       affinity;    // the CPUs allowed to the thread that built the object (restored by 'unpin')
+
+public:
+	/*!
+	 * \param n_threads: the number of threads of the simulation.
+	 * \param policy:    the placement policy ("NO", "COMPACT", "SCATTER" or "LIST").
+	 * \param cpu_list:  the logical CPU ids used by the "LIST" policy.
+	 * \param no_smt:    if set, use only the first hardware thread of each core.
+	 */
+	Thread_pinning(const int n_threads, const std::string &policy = "NO",
+	               const std::vector<int> &cpu_list = std::vector<int>(), const bool no_smt = false);
+
+	virtual ~Thread_pinning() = default;
+
+	/*!
+	 * \brief Binds the calling thread on the CPU of the thread 'tid' (does nothing with the "NO" policy).
+	 *
+	 * The modules and the buffers allocated by a thread after this call are first touched on its own NUMA node.
+	 */
+	void pin(const int tid) const;
+
+	/*!
+	 * \brief Restores the CPU affinity of the thread that built the object on the calling thread (does nothing with
+	 *        the "NO" policy).
+	 *
+	 * The main thread runs the thread 0: it has to be unpinned when the simulation threads are done.
+	 */
+	void unpin() const;
+
+	bool is_enabled() const;
+
+	/*!
+	 * \return the logical CPU id of the thread 'tid' (-1 if the threads are not pinned).
+	 */
+	int get_cpu(const int tid) const;
+
+protected:
+	void read_topology();
+};
+}
+}
+
+#endif /* THREAD_PINNING_HPP_ */
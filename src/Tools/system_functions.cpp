@@ -18,6 +18,7 @@
 #include <cstdlib>
 #include <cstdio>
 #include <vector>
+#include <fstream>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/system_functions.h"
@@ -244,4 +245,39 @@ void aff3ct::tools::split_path(const std::string& path, std::string &basedir, st
   found = path.find_last_of("/\\");
   basedir = path.substr(0,found);
   filename = path.substr(found+1);
-}
\ No newline at end of file
+}
+size_t aff3ct::tools::get_cache_size(const int level)
+{
+#if defined(__linux__) || defined(linux) || defined(__linux)
+	for (auto idx = 0; ; idx++)
+	{
+		const std::string path = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(idx) + "/";
+
+		std::ifstream file_level(path + "level");
+		if (!file_level.is_open())
+			break;
+
+		int cache_level = 0;
+		std::string type, size;
+		file_level >> cache_level;
+		std::ifstream(path + "type") >> type;
+		std::ifstream(path + "size") >> size;
+
+		if (cache_level != level || type == "Instruction" || size.empty())
+			continue;
+
+		// the size is given in bytes with an optional unit (ex: "32K", "1M")
+		size_t bytes = std::stoul(size);
+		switch (size.back())
+		{
+			case 'K': bytes <<= 10; break;
+			case 'M': bytes <<= 20; break;
+			case 'G': bytes <<= 30; break;
+			default: break;
+		}
+		return bytes;
+	}
+#endif
+
+	return 0;
+}
@@ -1,6 +1,7 @@
 #ifndef SYSTEM_FUNCTIONS_H_
 #define SYSTEM_FUNCTIONS_H_
 
+#include <cstddef>
 #include <string>
 
 namespace aff3ct
@@ -48,6 +49,14 @@ std::string get_binary_path();
  * \param filename is the name of the file without the base directory
  */
 void split_path(const std::string& path, std::string &basedir, std::string &filename);
+
+/*!
+ * \brief return the size of the data (or unified) cache of the given level seen by the first CPU
+ *
+ * \param level is the level of the cache (1 for the L1, 2 for the L2, ...)
+ * \return the size of the cache in bytes if supported (read from the Linux sysfs), 0 else
+ */
+size_t get_cache_size(const int level);
 }
 }
 
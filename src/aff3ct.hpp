@@ -418,9 +418,15 @@
 #ifndef DECODER_SISO_SIHO_HPP_
 #include <Module/Decoder/Decoder_SISO_SIHO.hpp>
 #endif
+#ifndef DECODER_CHASE_FAST_HPP_
+#include <Module/Decoder/Generic/Chase/Decoder_chase_fast.hpp>
+#endif
 #ifndef DECODER_CHASE_STD_HPP_
 #include <Module/Decoder/Generic/Chase/Decoder_chase_std.hpp>
 #endif
+#ifndef DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_
+#include <Module/Decoder/Generic/ML/Decoder_maximum_likelihood_fast.hpp>
+#endif
 #ifndef DECODER_MAXIMUM_LIKELIHOO_HPP_
 #include <Module/Decoder/Generic/ML/Decoder_maximum_likelihood.hpp>
 #endif
@@ -490,6 +496,9 @@
 #ifndef DECODER_POLAR_ASCL_MEM_FAST_SYS_CA
 #include <Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_MEM_fast_CA_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_
+#include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCAN_NAIVE_H_
 #include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp>
 #endif
@@ -505,6 +514,9 @@
 #ifndef DECODER_POLAR_SC_NAIVE_SYS_
 #include <Module/Decoder/Polar/SC/Decoder_polar_SC_naive_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCF_FAST_SYS_
+#include <Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCF_NAIVE_
 #include <Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive.hpp>
 #endif
@@ -553,6 +565,9 @@
 #ifndef DECODER_RSC_BCJR_INTER_FAST_HPP_
 #include <Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_fast.hpp>
 #endif
+#ifndef DECODER_RSC_BCJR_INTER_GENERIC_HPP_
+#include <Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_generic.hpp>
+#endif
 #ifndef DECODER_RSC_BCJR_INTER_HPP_
 #include <Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter.hpp>
 #endif
@@ -562,6 +577,9 @@
 #ifndef DECODER_RSC_BCJR_INTER_VERY_FAST_HPP_
 #include <Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_very_fast.hpp>
 #endif
+#ifndef DECODER_RSC_BCJR_INTER_WINDOW_HPP_
+#include <Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_window.hpp>
+#endif
 #ifndef DECODER_RSC_BCJR_INTER_INTRA_FAST_X2_AVX_HPP_
 #include <Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra_fast_x2_AVX.hpp>
 #endif
@@ -577,6 +595,9 @@
 #ifndef DECODER_RSC_BCJR_INTRA_FAST_HPP_
 #include <Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra_fast.hpp>
 #endif
+#ifndef DECODER_RSC_BCJR_INTRA_GENERIC_HPP_
+#include <Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra_generic.hpp>
+#endif
 #ifndef DECODER_RSC_BCJR_INTRA_HPP_
 #include <Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra.hpp>
 #endif
@@ -607,6 +628,9 @@
 #ifndef DECODER_RSC_BCJR_STD_GENERIC_SEQ_JSON_HPP_
 #include <Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic_std_json.hpp>
 #endif
+#ifndef DECODER_RSC_BCJR_SUBBLOCK_HPP_
+#include <Module/Decoder/RSC/BCJR/Subblock/Decoder_RSC_BCJR_subblock.hpp>
+#endif
 #ifndef DECODER_RSC_DB_BCJR_DVB_RCS1_HPP_
 #include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_DVB_RCS1.hpp>
 #endif
@@ -619,9 +643,15 @@
 #ifndef DECODER_RSC_DB_BCJR_HPP_
 #include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR.hpp>
 #endif
+#ifndef DECODER_RSC_DB_BCJR_INTER_HPP_
+#include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_inter.hpp>
+#endif
 #ifndef DECODER_RS
 #include <Module/Decoder/RS/Decoder_RS.hpp>
 #endif
+#ifndef DECODER_RS_FAST
+#include <Module/Decoder/RS/Fast/Decoder_RS_fast.hpp>
+#endif
 #ifndef DECODER_RS_GENIUS
 #include <Module/Decoder/RS/Genius/Decoder_RS_genius.hpp>
 #endif
@@ -805,6 +835,9 @@
 #ifndef QUANTIZER_CUSTOM_HPP_
 #include <Module/Quantizer/Custom/Quantizer_custom.hpp>
 #endif
+#ifndef QUANTIZER_FUSED_BPSK_AWGN_HPP_
+#include <Module/Quantizer/Fused/Quantizer_fused_BPSK_AWGN.hpp>
+#endif
 #ifndef QUANTIZER_NO_HPP_
 #include <Module/Quantizer/NO/Quantizer_NO.hpp>
 #endif
@@ -853,6 +886,9 @@
 #ifndef SIMULATION_BFER_ITE_THREADS_HPP_
 #include <Simulation/BFER/Iterative/Threads/BFER_ite_threads.hpp>
 #endif
+#ifndef SIMULATION_BFER_STD_BENCH_HPP_
+#include <Simulation/BFER/Standard/Bench/BFER_std_bench.hpp>
+#endif
 #ifndef SIMULATION_BFER_STD_HPP_
 #include <Simulation/BFER/Standard/BFER_std.hpp>
 #endif
@@ -862,6 +898,9 @@
 #ifndef SIMULATION_BFER_STD_THREADS_HPP_
 #include <Simulation/BFER/Standard/Threads/BFER_std_threads.hpp>
 #endif
+#ifndef SIMULATION_BFER_STD_TUNE_HPP_
+#include <Simulation/BFER/Standard/Tune/BFER_std_tune.hpp>
+#endif
 #ifndef SIMULATION_EXIT_HPP_
 #include <Simulation/EXIT/EXIT.hpp>
 #endif
@@ -886,6 +925,9 @@
 #ifndef EVENT_GENERATOR_MKL_HPP
 #include <Tools/Algo/Draw_generator/Event_generator/MKL/Event_generator_MKL.hpp>
 #endif
+#ifndef EVENT_GENERATOR_SPARSE_HPP
+#include <Tools/Algo/Draw_generator/Event_generator/Sparse/Event_generator_sparse.hpp>
+#endif
 #ifndef EVENT_GENERATOR_STD_HPP
 #include <Tools/Algo/Draw_generator/Event_generator/Standard/Event_generator_std.hpp>
 #endif
@@ -919,6 +961,9 @@
 #ifndef USER_PDF_NOISE_GENERATOR_HPP
 #include <Tools/Algo/Draw_generator/User_pdf_noise_generator/User_pdf_noise_generator.hpp>
 #endif
+#ifndef HISTOGRAM_DENSE_HPP__
+#include <Tools/Algo/Histogram_dense.hpp>
+#endif
 #ifndef HISTOGRAM_HPP__
 #include <Tools/Algo/Histogram.hpp>
 #endif
@@ -955,6 +1000,9 @@
 #ifndef PRNG_MT19937_SIMD_HPP
 #include <Tools/Algo/PRNG/PRNG_MT19937_simd.hpp>
 #endif
+#ifndef PRNG_SPLITMIX64_HPP
+#include <Tools/Algo/PRNG/PRNG_splitmix64.hpp>
+#endif
 #ifndef LC_SORTER_HPP
 #include <Tools/Algo/Sort/LC_sorter.hpp>
 #endif
@@ -1354,9 +1402,15 @@
 #ifndef REPORTER_THROUGHPUT_HPP_
 #include <Tools/Display/Reporter/Throughput/Reporter_throughput.hpp>
 #endif
+#ifndef BENCHMARK_HPP_
+#include <Tools/Display/Statistics/Benchmark.hpp>
+#endif
 #ifndef STATISTICS_HPP_
 #include <Tools/Display/Statistics/Statistics.hpp>
 #endif
+#ifndef TERMINAL_METRICS_HPP_
+#include <Tools/Display/Terminal/Metrics/Terminal_metrics.hpp>
+#endif
 #ifndef TERMINAL_STD_HPP_
 #include <Tools/Display/Terminal/Standard/Terminal_std.hpp>
 #endif
@@ -1450,6 +1504,9 @@
 #ifndef GALOIS_HPP
 #include <Tools/Math/Galois.hpp>
 #endif
+#ifndef GALOIS_KERNELS_HPP_
+#include <Tools/Math/Galois_kernels.hpp>
+#endif
 #ifndef INTERPOLATION_H_
 #include <Tools/Math/interpolation.h>
 #endif
@@ -1537,6 +1594,9 @@
 #ifndef SYSTEM_FUNCTIONS_H_
 #include <Tools/system_functions.h>
 #endif
+#ifndef THREAD_PINNING_HPP_
+#include <Tools/Thread_pinning/Thread_pinning.hpp>
+#endif
 #ifndef TYPES_H_
 #include <Tools/types.h>
 #endif
@@ -1,4 +1,5 @@
 #include <exception>
+#include <algorithm>
 #include <iostream>
 #include <cstdlib>
 #include <vector>
@@ -208,8 +209,17 @@ int sc_main(int argc, char **argv)
 	MPI_Init(nullptr, nullptr);
 #endif
 
+	std::vector<const char*> args(argv, argv + argc);
+#ifdef AFF3CT_BENCH
+	// the micro-benchmark executable always runs the BFER simulation in benchmark mode
+	if (std::find_if(args.begin(), args.end(), [](const char* a) { return std::string(a) == "--sim-bench"; })
+	    == args.end())
+		args.push_back("--sim-bench");
+#endif
+	const auto n_args = (int)args.size();
+
 	factory::Launcher::parameters params("sim");
-	if (read_arguments(argc, (const char**)argv, params) == EXIT_FAILURE)
+	if (read_arguments(n_args, args.data(), params) == EXIT_FAILURE)
 		return EXIT_FAILURE;
 
 	try
@@ -218,14 +228,14 @@ int sc_main(int argc, char **argv)
 #ifdef AFF3CT_MULTI_PREC
 		switch (params.sim_prec)
 		{
-			case  8: launcher = factory::Launcher::build<B_8, R_8, Q_8 >(params, argc, (const char**)argv); break;
-			case 16: launcher = factory::Launcher::build<B_16,R_16,Q_16>(params, argc, (const char**)argv); break;
-			case 32: launcher = factory::Launcher::build<B_32,R_32,Q_32>(params, argc, (const char**)argv); break;
-			case 64: launcher = factory::Launcher::build<B_64,R_64,Q_64>(params, argc, (const char**)argv); break;
+			case  8: launcher = factory::Launcher::build<B_8, R_8, Q_8 >(params, n_args, args.data()); break;
+			case 16: launcher = factory::Launcher::build<B_16,R_16,Q_16>(params, n_args, args.data()); break;
+			case 32: launcher = factory::Launcher::build<B_32,R_32,Q_32>(params, n_args, args.data()); break;
+			case 64: launcher = factory::Launcher::build<B_64,R_64,Q_64>(params, n_args, args.data()); break;
 			default: launcher = nullptr; break;
 		}
 #else
-		launcher = factory::Launcher::build<B,R,Q>(params, argc, (const char**)argv);
+		launcher = factory::Launcher::build<B,R,Q>(params, n_args, args.data());
 #endif
 		if (launcher != nullptr)
 		{